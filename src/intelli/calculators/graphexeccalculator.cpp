@@ -10,7 +10,9 @@
 #include "graphexeccalculator.h"
 
 #include <intelli/graph.h>
+#include <intelli/executionplan.h>
 #include <intelli/graphexecmodel.h>
+#include <intelli/noderesultcache.h>
 
 #include <intelli/node/input/boolinput.h>
 #include <intelli/node/input/intinput.h>
@@ -34,11 +36,27 @@ GraphExecCalculator::GraphExecCalculator() :
     m_intelli("intelli", tr("IntelliGraph"),
                 tr("Link to IntelliGraph"), "",
                 this, QStringList() << GT_CLASSNAME(Graph)),
+    m_usePlanExecutor("usePlanExecutor",
+                      tr("Use Plan Executor"),
+                      tr("Evaluates the graph sequentially in the thread of "
+                         "the calculator without an execution model. Eval "
+                         "modes of the nodes (e.g. detached, isolated, or "
+                         "async) and exclusive resources are not considered."),
+                      false),
+    m_useResultCache("useResultCache",
+                     tr("Use Result Cache"),
+                     tr("Loads the results of cacheable nodes from the node "
+                        "result cache of the application, which persists "
+                        "across sessions, instead of evaluating them. Not "
+                        "used by the plan executor."),
+                     false),
     m_numberNodeContainer("propertyNodes", "Property Nodes")//,
 {
 
     setObjectName("Graph Execution");
     registerProperty(m_intelli);
+    registerProperty(m_usePlanExecutor);
+    registerProperty(m_useResultCache);
 
     auto makeStringWithEmptySpace = [](QString const& id)
     {
@@ -156,10 +174,26 @@ GraphExecCalculator::run()
         }
     }
 
+    if (m_usePlanExecutor)
+    {
+        // evaluate a snapshot of the graph without an exec model, only nodes
+        // that contribute to the sinks of the graph are evaluated
+        PlanExecutor executor{ExecutionPlan::compileSinks(*graph)};
+        if (!executor.isValid())
+        {
+            gtError() << tr("Failed to compile IntelliGraph!");
+            return false;
+        }
+
+        return executor.run();
+    }
+
     GraphExecutionModel model(*graph);
+    if (m_useResultCache) model.setResultCache(NodeResultCache::defaultCache());
 
+    // only evaluate nodes that contribute to the sinks of the graph
     /// TODO: enable custom timeout
-    bool success = model.evaluateGraph().wait(std::chrono::minutes{5});
+    bool success = model.evaluateSinks().wait(std::chrono::minutes{5});
 
     /// TODO: Add monitoring information if possible
     return success;
@@ -11,6 +11,7 @@
 #define GT_INTELLI_GRAPHEXECCALCULATOR_H
 
 #include <gt_calculator.h>
+#include <gt_boolproperty.h>
 #include <gt_objectlinkproperty.h>
 #include <gt_propertystructcontainer.h>
 
@@ -29,6 +30,12 @@ private:
     /// component to read
     GtObjectLinkProperty m_intelli;
 
+    /// whether the graph is evaluated sequentially using an execution plan
+    GtBoolProperty m_usePlanExecutor;
+
+    /// whether results are loaded from and stored in the node result cache
+    GtBoolProperty m_useResultCache;
+
     GtPropertyStructContainer m_numberNodeContainer;
 };
 }
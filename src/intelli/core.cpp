@@ -17,6 +17,8 @@
 #include "intelli/data/int.h"
 #include "intelli/data/file.h"
 #include "intelli/data/stringlist.h"
+#include "intelli/data/list.h"
+#include "intelli/data/array.h"
 
 #include "intelli/node/dummy.h"
 
@@ -26,6 +28,9 @@
 
 #include "intelli/node/numberdisplay.h"
 #include "intelli/node/numbermath.h"
+#include "intelli/node/arraymath.h"
+#include "intelli/node/arraycompare.h"
+#include "intelli/node/arrayreduce.h"
 #include "intelli/node/sleepy.h"
 
 #include "intelli/node/objectmemento.h"
@@ -33,6 +38,7 @@
 #include "intelli/node/existingdirectorysource.h"
 
 #include "intelli/node/logicoperation.h"
+#include "intelli/node/arraylogic.h"
 
 #include "intelli/node/stringbuilder.h"
 
@@ -51,6 +57,8 @@
 #include "intelli/node/filereader.h"
 #include "intelli/node/filewriter.h"
 #include "intelli/node/stringselection.h"
+#include "intelli/node/map.h"
+#include "intelli/node/switch.h"
 
 #include "intelli/node/projectinfo.h"
 
@@ -63,8 +71,79 @@
 #include "intelli/node/binarydisplay.h"
 #endif
 
+#include <algorithm>
+
 using namespace intelli;
 
+namespace
+{
+
+std::shared_ptr<ListData const>
+stringListToList(std::shared_ptr<StringListData const> const& data)
+{
+    std::vector<NodeDataPtr> values;
+    values.reserve(data->value().size());
+    for (QString const& value : data->value())
+    {
+        values.push_back(makeNodeData<StringData>(value));
+    }
+    return std::make_shared<ListData const>(std::move(values));
+}
+
+std::shared_ptr<StringListData const>
+listToStringList(std::shared_ptr<ListData const> const& data)
+{
+    QStringList values;
+    values.reserve((int)data->size());
+    for (NodeDataPtr const& value : data->value())
+    {
+        auto string = convert<StringData>(value);
+        if (!string) return nullptr;
+        values.push_back(string->value());
+    }
+    return std::make_shared<StringListData const>(std::move(values));
+}
+
+/// converts the elements of an array to the value type of `To`
+template <typename To, typename From>
+std::shared_ptr<To const>
+castArray(std::shared_ptr<From const> const& data)
+{
+    using T = typename To::value_type;
+
+    std::vector<T> values(data->size());
+    std::transform(data->value().begin(), data->value().end(), values.begin(),
+                   [](auto value){ return static_cast<T>(value); });
+    return std::make_shared<To const>(std::move(values));
+}
+
+std::shared_ptr<DoubleArrayData const>
+listToDoubleArray(std::shared_ptr<ListData const> const& data)
+{
+    std::vector<double> values;
+    values.reserve(data->size());
+    for (NodeDataPtr const& value : data->value())
+    {
+        auto number = convert<DoubleData>(value);
+        if (!number) return nullptr;
+        values.push_back(number->value());
+    }
+    return std::make_shared<DoubleArrayData const>(std::move(values));
+}
+
+std::shared_ptr<ListData const>
+doubleArrayToList(std::shared_ptr<DoubleArrayData const> const& data)
+{
+    std::vector<NodeDataPtr> values;
+    values.reserve(data->size());
+    for (double value : data->value())
+    {
+        values.push_back(makeNodeData<DoubleData>(value));
+    }
+    return std::make_shared<ListData const>(std::move(values));
+}
+
+} // namespace
 
 void
 intelli::initModule()
@@ -83,11 +162,15 @@ intelli::registerDefaultDataTypes()
         GT_INTELLI_REGISTER_DATA(ByteArrayData);
         GT_INTELLI_REGISTER_DATA(StringData);
         GT_INTELLI_REGISTER_DATA(StringListData);
+        GT_INTELLI_REGISTER_DATA(ListData);
         GT_INTELLI_REGISTER_DATA(DoubleData);
         GT_INTELLI_REGISTER_DATA(IntData);
         GT_INTELLI_REGISTER_DATA(BoolData);
         GT_INTELLI_REGISTER_DATA(ObjectData);
         GT_INTELLI_REGISTER_DATA(FileData);
+        GT_INTELLI_REGISTER_DATA(DoubleArrayData);
+        GT_INTELLI_REGISTER_DATA(FloatArrayData);
+        GT_INTELLI_REGISTER_DATA(IntArrayData);
 
         // register conversions
         gtTrace().verbose() << QObject::tr("Registering default conversions...");
@@ -98,6 +181,21 @@ intelli::registerDefaultDataTypes()
         GT_INTELLI_REGISTER_INLINE_CONVERSION(DoubleData, IntData, data->value());
         GT_INTELLI_REGISTER_INLINE_CONVERSION(IntData, DoubleData, data->value());
 
+        GT_INTELLI_REGISTER_CONVERSION(StringListData, ListData, stringListToList);
+        GT_INTELLI_REGISTER_CONVERSION(ListData, StringListData, listToStringList);
+
+        GT_INTELLI_REGISTER_INLINE_CONVERSION(DoubleData, DoubleArrayData, std::vector<double>{data->value()});
+        GT_INTELLI_REGISTER_INLINE_CONVERSION(IntData, DoubleArrayData, std::vector<double>{(double)data->value()});
+        GT_INTELLI_REGISTER_INLINE_CONVERSION(IntData, IntArrayData, std::vector<int>{data->value()});
+
+        GT_INTELLI_REGISTER_CONVERSION(IntArrayData, DoubleArrayData, castArray<DoubleArrayData>);
+        GT_INTELLI_REGISTER_CONVERSION(DoubleArrayData, IntArrayData, castArray<IntArrayData>);
+        GT_INTELLI_REGISTER_CONVERSION(FloatArrayData, DoubleArrayData, castArray<DoubleArrayData>);
+        GT_INTELLI_REGISTER_CONVERSION(DoubleArrayData, FloatArrayData, castArray<FloatArrayData>);
+
+        GT_INTELLI_REGISTER_CONVERSION(ListData, DoubleArrayData, listToDoubleArray);
+        GT_INTELLI_REGISTER_CONVERSION(DoubleArrayData, ListData, doubleArrayToList);
+
         return true;
     }();
 
@@ -129,10 +227,15 @@ intelli::registerDefaultNodes()
 
         GT_INTELLI_REGISTER_NODE(NumberDisplayNode, catDisplay);
         GT_INTELLI_REGISTER_NODE(NumberMathNode, catNumber);
+        GT_INTELLI_REGISTER_NODE(ArrayMathNode, catNumber);
+        GT_INTELLI_REGISTER_NODE(ArrayCompareNode, catNumber);
+        GT_INTELLI_REGISTER_NODE(ArrayReduceNode, catNumber);
         GT_INTELLI_REGISTER_NODE(SleepyNode, (gtApp && gtApp->devMode()) ? catOther : hidden);
         GT_INTELLI_REGISTER_NODE(BoolDisplayNode, catDisplay);
 
         GT_INTELLI_REGISTER_NODE(LogicNode, catLogic);
+        GT_INTELLI_REGISTER_NODE(ArrayLogicNode, catLogic);
+        GT_INTELLI_REGISTER_NODE(SwitchNode, catLogic);
 
         GT_INTELLI_REGISTER_NODE(TextDisplayNode, catDisplay);
 
@@ -158,6 +261,7 @@ intelli::registerDefaultNodes()
         GT_INTELLI_REGISTER_NODE(StringSelectionNode, catString);
 
         GT_INTELLI_REGISTER_NODE(GenericCalculatorExecNode, catProcess);
+        GT_INTELLI_REGISTER_NODE(MapNode, catProcess);
 
 #ifdef GT_INTELLI_EXPERIMENTAL_NODES
         GT_INTELLI_REGISTER_NODE(BinaryDisplayNode, catDisplay);
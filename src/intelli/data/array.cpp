@@ -0,0 +1,48 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/data/array.h"
+
+using namespace intelli;
+
+DoubleArrayData::DoubleArrayData() :
+    DoubleArrayData(std::vector<double>{})
+{
+
+}
+
+DoubleArrayData::DoubleArrayData(std::vector<double> values) :
+    ArrayData(QStringLiteral("doublearray"), std::move(values))
+{
+
+}
+
+FloatArrayData::FloatArrayData() :
+    FloatArrayData(std::vector<float>{})
+{
+
+}
+
+FloatArrayData::FloatArrayData(std::vector<float> values) :
+    ArrayData(QStringLiteral("floatarray"), std::move(values))
+{
+
+}
+
+IntArrayData::IntArrayData() :
+    IntArrayData(std::vector<int>{})
+{
+
+}
+
+IntArrayData::IntArrayData(std::vector<int> values) :
+    ArrayData(QStringLiteral("intarray"), std::move(values))
+{
+
+}
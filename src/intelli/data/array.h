@@ -0,0 +1,160 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYDATA_H
+#define GT_INTELLI_ARRAYDATA_H
+
+#include <intelli/nodedata.h>
+#include <intelli/view.h>
+
+#include <QDataStream>
+
+#include <vector>
+
+namespace intelli
+{
+
+/**
+ * @brief Base class of node data holding a contiguous array of numeric values.
+ * The values can be accessed without copying using `view`. Arrays of size one
+ * are broadcasted by the element-wise array nodes, thus scalars can be
+ * combined with arrays (see the registered conversions of `DoubleData` and
+ * `IntData`).
+ */
+template <typename T>
+class ArrayData : public NodeData
+{
+public:
+
+    using value_type = T;
+
+    /**
+     * @brief Returns the values of the array
+     * @return Values
+     */
+    std::vector<T> const& value() const { return m_data; }
+
+    /**
+     * @brief Returns a view on the values of the array
+     * @return View
+     */
+    View<T> view() const { return View<T>(m_data.data(), m_data.size()); }
+
+    /**
+     * @brief Returns the number of values
+     * @return Size
+     */
+    size_t size() const { return m_data.size(); }
+
+    /**
+     * @brief Returns the value at `idx`
+     * @param idx Index
+     * @return Value (zero if out of range)
+     */
+    T at(size_t idx) const { return idx < m_data.size() ? m_data[idx] : T{}; }
+
+    bool isEqualTo(NodeData const& other) const override
+    {
+        return m_data == static_cast<ArrayData<T> const&>(other).m_data;
+    }
+
+    bool serialize(QDataStream& stream) const override
+    {
+        stream << (quint64)m_data.size();
+        for (T value : m_data) stream << value;
+        return stream.status() == QDataStream::Ok;
+    }
+
+    bool deserialize(QDataStream& stream) override
+    {
+        quint64 size = 0;
+        stream >> size;
+        if (stream.status() != QDataStream::Ok) return false;
+
+        m_data.clear();
+        m_data.reserve(size);
+        for (quint64 i = 0; i < size; ++i)
+        {
+            T value{};
+            stream >> value;
+            if (stream.status() != QDataStream::Ok) return false;
+            m_data.push_back(value);
+        }
+        return true;
+    }
+
+    size_t byteSize() const override
+    {
+        return m_data.size() * sizeof(T);
+    }
+
+protected:
+
+    ArrayData(QString typeName, std::vector<T> values) :
+        NodeData(std::move(typeName)),
+        m_data(std::move(values))
+    {}
+
+private:
+
+    std::vector<T> m_data;
+};
+
+/**
+ * @brief Array of double values
+ */
+class GT_INTELLI_EXPORT DoubleArrayData : public ArrayData<double>
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE DoubleArrayData();
+
+    explicit DoubleArrayData(std::vector<double> values);
+
+    Q_INVOKABLE int count() const { return (int)size(); }
+};
+
+/**
+ * @brief Array of float values
+ */
+class GT_INTELLI_EXPORT FloatArrayData : public ArrayData<float>
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE FloatArrayData();
+
+    explicit FloatArrayData(std::vector<float> values);
+
+    Q_INVOKABLE int count() const { return (int)size(); }
+};
+
+/**
+ * @brief Array of integer values. Used as mask by the element-wise comparison
+ * and logic nodes (non-zero values are considered true).
+ */
+class GT_INTELLI_EXPORT IntArrayData : public ArrayData<int>
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE IntArrayData();
+
+    explicit IntArrayData(std::vector<int> values);
+
+    Q_INVOKABLE int count() const { return (int)size(); }
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYDATA_H
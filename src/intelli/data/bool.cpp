@@ -9,6 +9,8 @@
 
 #include "intelli/data/bool.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 BoolData::BoolData(bool val) :
@@ -24,3 +26,28 @@ BoolData::value() const
     return m_data;
 }
 
+void
+BoolData::setValue(bool val)
+{
+    m_data = val;
+}
+
+bool
+BoolData::isEqualTo(NodeData const& other) const
+{
+    return value() == static_cast<BoolData const&>(other).value();
+}
+
+bool
+BoolData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+BoolData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
@@ -25,6 +25,19 @@ public:
 
     Q_INVOKABLE bool value() const;
 
+    bool isEqualTo(NodeData const& other) const override;
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    /**
+     * @brief Setter for the value. Should only be used to recycle unused
+     * objects, as node data is immutable once shared (see `NodeDataPool`).
+     * @param val New value
+     */
+    void setValue(bool val);
+
 private:
     bool m_data;
 };
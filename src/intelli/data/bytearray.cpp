@@ -9,6 +9,8 @@
 
 #include <intelli/data/bytearray.h>
 
+#include <QDataStream>
+
 using namespace intelli;
 
 ByteArrayData::ByteArrayData(QByteArray ba) :
@@ -21,3 +23,33 @@ ByteArrayData::value() const
 {
     return m_data;
 }
+
+bool
+ByteArrayData::isEqualTo(NodeData const& other) const
+{
+    // comparing the contents is too expensive for large arrays, thus only
+    // arrays sharing the same buffer are considered equal
+    QByteArray const& data = static_cast<ByteArrayData const&>(other).m_data;
+    return m_data.size() == data.size() &&
+           m_data.constData() == data.constData();
+}
+
+bool
+ByteArrayData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+ByteArrayData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+size_t
+ByteArrayData::byteSize() const
+{
+    return (size_t)m_data.size();
+}
@@ -29,6 +29,14 @@ public:
 
     Q_INVOKABLE QByteArray value() const;
 
+    bool isEqualTo(NodeData const& other) const override;
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    size_t byteSize() const override;
+
 private:
     QByteArray m_data;
 };
@@ -9,6 +9,8 @@
 
 #include "intelli/data/double.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 DoubleData::DoubleData(double val) :
@@ -23,3 +25,29 @@ DoubleData::value() const
 {
     return m_data;
 }
+
+void
+DoubleData::setValue(double val)
+{
+    m_data = val;
+}
+
+bool
+DoubleData::isEqualTo(NodeData const& other) const
+{
+    return value() == static_cast<DoubleData const&>(other).value();
+}
+
+bool
+DoubleData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+DoubleData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
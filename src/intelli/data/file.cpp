@@ -9,6 +9,8 @@
 
 #include <intelli/data/file.h>
 
+#include <QDataStream>
+
 using namespace intelli;
 
 FileData::FileData(QFileInfo file) :
@@ -24,3 +26,18 @@ FileData::value() const
     return m_file;
 }
 
+bool
+FileData::serialize(QDataStream& stream) const
+{
+    stream << m_file.filePath();
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+FileData::deserialize(QDataStream& stream)
+{
+    QString path;
+    stream >> path;
+    m_file = QFileInfo(path);
+    return stream.status() == QDataStream::Ok;
+}
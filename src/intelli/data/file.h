@@ -27,6 +27,10 @@ public:
 
     Q_INVOKABLE QFileInfo value() const;
 
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
 private:
     QFileInfo m_file;
 };
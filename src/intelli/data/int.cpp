@@ -9,6 +9,8 @@
 
 #include "intelli/data/int.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 IntData::IntData(int val) :
@@ -23,3 +25,29 @@ IntData::value() const
 {
     return m_data;
 }
+
+void
+IntData::setValue(int val)
+{
+    m_data = val;
+}
+
+bool
+IntData::isEqualTo(NodeData const& other) const
+{
+    return value() == static_cast<IntData const&>(other).value();
+}
+
+bool
+IntData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+IntData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
@@ -14,3 +14,17 @@ using namespace intelli;
 InvalidData::InvalidData() :
     NodeData("n/a")
 { }
+
+bool
+InvalidData::serialize(QDataStream& stream) const
+{
+    Q_UNUSED(stream);
+    return true;
+}
+
+bool
+InvalidData::deserialize(QDataStream& stream)
+{
+    Q_UNUSED(stream);
+    return true;
+}
@@ -25,6 +25,10 @@ class GT_INTELLI_EXPORT InvalidData : public intelli::NodeData
 public:
 
     Q_INVOKABLE InvalidData();
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
 };
 
 } // namespace intelli
@@ -0,0 +1,105 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/data/list.h"
+
+#include "intelli/nodedatafactory.h"
+
+#include <QDataStream>
+
+#include <algorithm>
+
+using namespace intelli;
+
+ListData::ListData() :
+    ListData(std::vector<NodeDataPtr>{})
+{
+
+}
+
+ListData::ListData(std::vector<NodeDataPtr> values) :
+    NodeData(QStringLiteral("list")),
+    m_data(std::move(values))
+{
+
+}
+
+std::vector<NodeDataPtr> const&
+ListData::value() const
+{
+    return m_data;
+}
+
+size_t
+ListData::size() const
+{
+    return m_data.size();
+}
+
+NodeDataPtr
+ListData::at(size_t idx) const
+{
+    if (idx >= m_data.size()) return nullptr;
+    return m_data[idx];
+}
+
+bool
+ListData::isEqualTo(NodeData const& other) const
+{
+    auto const& otherData = static_cast<ListData const&>(other).value();
+    return std::equal(m_data.begin(), m_data.end(),
+                      otherData.begin(), otherData.end(),
+                      [](NodeDataPtr const& a, NodeDataPtr const& b){
+        return isEqual(a, b);
+    });
+}
+
+bool
+ListData::serialize(QDataStream& stream) const
+{
+    auto& factory = NodeDataFactory::instance();
+
+    stream << (quint64)m_data.size();
+    return std::all_of(m_data.begin(), m_data.end(),
+                       [&](NodeDataPtr const& data){
+        return factory.serialize(data, stream);
+    });
+}
+
+bool
+ListData::deserialize(QDataStream& stream)
+{
+    auto& factory = NodeDataFactory::instance();
+
+    quint64 size = 0;
+    stream >> size;
+    if (stream.status() != QDataStream::Ok) return false;
+
+    m_data.clear();
+    m_data.reserve(size);
+    for (quint64 i = 0; i < size; ++i)
+    {
+        auto data = factory.deserialize(stream);
+        if (!data) return false;
+
+        m_data.push_back(std::move(*data));
+    }
+    return true;
+}
+
+size_t
+ListData::byteSize() const
+{
+    size_t size = 0;
+    for (NodeDataPtr const& data : m_data)
+    {
+        if (data) size += data->byteSize();
+    }
+    return size;
+}
@@ -0,0 +1,66 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_LISTDATA_H
+#define GT_INTELLI_LISTDATA_H
+
+#include <intelli/nodedata.h>
+
+#include <vector>
+
+namespace intelli
+{
+
+/**
+ * @brief Generic list of node data. The elements may be of any data type.
+ */
+class GT_INTELLI_EXPORT ListData : public NodeData
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE ListData();
+
+    explicit ListData(std::vector<NodeDataPtr> values);
+
+    /**
+     * @brief Returns the elements of the list
+     * @return Elements (may contain null)
+     */
+    std::vector<NodeDataPtr> const& value() const;
+
+    /**
+     * @brief Returns the number of elements
+     * @return Size
+     */
+    Q_INVOKABLE size_t size() const;
+
+    /**
+     * @brief Returns the element at `idx`
+     * @param idx Index
+     * @return Element (null if out of range)
+     */
+    NodeDataPtr at(size_t idx) const;
+
+    bool isEqualTo(NodeData const& other) const override;
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    size_t byteSize() const override;
+
+private:
+    std::vector<NodeDataPtr> m_data;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_LISTDATA_H
@@ -9,6 +9,11 @@
 
 #include "intelli/data/object.h"
 
+#include <gt_objectfactory.h>
+#include <gt_objectmemento.h>
+
+#include <QDataStream>
+
 using namespace intelli;
 
 ObjectData::ObjectData(GtObject const* obj) :
@@ -19,3 +24,41 @@ ObjectData::ObjectData(GtObject const* obj) :
 }
 
 ObjectData::~ObjectData() = default;
+
+bool
+ObjectData::serialize(QDataStream& stream) const
+{
+    // objects are transferred as mementos
+    stream << (m_obj ? m_obj->toMemento().toByteArray() : QByteArray{});
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+ObjectData::deserialize(QDataStream& stream)
+{
+    QByteArray bytes;
+    stream >> bytes;
+    if (stream.status() != QDataStream::Ok) return false;
+
+    m_byteSize = bytes.size();
+
+    if (bytes.isEmpty())
+    {
+        m_obj.reset();
+        return true;
+    }
+
+    GtObjectMemento memento(bytes);
+    m_obj.reset(memento.toObject(*gtObjectFactory));
+    return m_obj.get() != nullptr;
+}
+
+size_t
+ObjectData::byteSize() const
+{
+    if (m_byteSize < 0)
+    {
+        m_byteSize = m_obj ? m_obj->toMemento().toByteArray().size() : 0;
+    }
+    return (size_t)m_byteSize.load();
+}
@@ -13,6 +13,8 @@
 #include <intelli/nodedata.h>
 #include <intelli/memory.h>
 
+#include <atomic>
+
 namespace intelli
 {
 
@@ -39,9 +41,22 @@ public:
      */
     Q_INVOKABLE GtObject const* object() const { return m_obj.get(); }
 
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    /**
+     * @brief Returns the size of the memento of the object. The size is
+     * determined once on demand.
+     * @return Size in bytes
+     */
+    size_t byteSize() const override;
+
 private:
     
     unique_qptr<GtObject, DeferredDeleter> m_obj;
+    /// cached size of the memento (negative if not determined yet)
+    mutable std::atomic<qint64> m_byteSize{-1};
 };
 
 } // namespace intelli
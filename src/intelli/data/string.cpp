@@ -9,6 +9,8 @@
 
 #include "intelli/data/string.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 StringData::StringData(QString val):
@@ -23,3 +25,35 @@ StringData::value() const
 {
     return m_data;
 }
+
+void
+StringData::setValue(QString val)
+{
+    m_data = std::move(val);
+}
+
+bool
+StringData::isEqualTo(NodeData const& other) const
+{
+    return value() == static_cast<StringData const&>(other).value();
+}
+
+bool
+StringData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+StringData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+size_t
+StringData::byteSize() const
+{
+    return (size_t)m_data.size() * sizeof(QChar);
+}
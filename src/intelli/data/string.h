@@ -25,6 +25,21 @@ public:
 
     Q_INVOKABLE QString value() const;
 
+    bool isEqualTo(NodeData const& other) const override;
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    size_t byteSize() const override;
+
+    /**
+     * @brief Setter for the value. Should only be used to recycle unused
+     * objects, as node data is immutable once shared (see `NodeDataPool`).
+     * @param val New value
+     */
+    void setValue(QString val);
+
 private:
     QString m_data;
 };
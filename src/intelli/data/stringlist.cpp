@@ -9,6 +9,8 @@
 
 #include "intelli/data/stringlist.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 StringListData::StringListData(QStringList val) :
@@ -29,3 +31,38 @@ intelli::StringListData::setValue(QStringList val)
 {
     m_data = std::move(val);
 }
+
+bool
+StringListData::isEqualTo(NodeData const& other) const
+{
+    // comparing the contents is too expensive for large lists, thus only
+    // lists sharing the same buffer are considered equal
+    QStringList const& data = static_cast<StringListData const&>(other).m_data;
+    return m_data.size() == data.size() &&
+           (m_data.isEmpty() || m_data.constBegin() == data.constBegin());
+}
+
+bool
+StringListData::serialize(QDataStream& stream) const
+{
+    stream << m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+StringListData::deserialize(QDataStream& stream)
+{
+    stream >> m_data;
+    return stream.status() == QDataStream::Ok;
+}
+
+size_t
+StringListData::byteSize() const
+{
+    size_t size = 0;
+    for (QString const& entry : m_data)
+    {
+        size += (size_t)entry.size() * sizeof(QChar);
+    }
+    return size;
+}
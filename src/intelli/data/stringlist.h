@@ -21,6 +21,14 @@ public:
 
     Q_INVOKABLE QStringList const& value() const;
 
+    bool isEqualTo(NodeData const& other) const override;
+
+    bool serialize(QDataStream& stream) const override;
+
+    bool deserialize(QDataStream& stream) override;
+
+    size_t byteSize() const override;
+
     Q_INVOKABLE void setValue(QStringList val);
 
 private:
@@ -0,0 +1,120 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/evalpromise.h"
+
+#include <QMutex>
+
+#include <algorithm>
+
+using namespace intelli;
+
+struct EvalPromise::State
+{
+    QMutex mutex;
+    /// output data set by the node
+    NodeDataPtrList data;
+    /// whether the promise was completed
+    bool finished = false;
+    /// predicate to check whether the evaluation was canceled
+    std::function<bool()> isCanceled;
+    /// callback invoked once completed
+    Callback onFinished;
+
+    /// all promises were destroyed without completing the evaluation
+    ~State() { complete(false); }
+
+    void complete(bool success)
+    {
+        Callback callback;
+        NodeDataPtrList outData;
+        {
+            QMutexLocker locker{&mutex};
+            if (finished) return;
+            finished = true;
+
+            callback = std::move(onFinished);
+            if (success) outData = std::move(data);
+            data.clear();
+        }
+
+        if (callback) callback(std::move(outData), success);
+    }
+};
+
+EvalPromise::EvalPromise() = default;
+
+EvalPromise
+EvalPromise::make(std::function<bool()> isCanceled, Callback onFinished)
+{
+    EvalPromise promise;
+    promise.m_state = std::make_shared<State>();
+    promise.m_state->isCanceled = std::move(isCanceled);
+    promise.m_state->onFinished = std::move(onFinished);
+    return promise;
+}
+
+bool
+EvalPromise::isValid() const
+{
+    return m_state != nullptr;
+}
+
+bool
+EvalPromise::isFinished() const
+{
+    if (!m_state) return true;
+
+    QMutexLocker locker{&m_state->mutex};
+    return m_state->finished;
+}
+
+bool
+EvalPromise::isCanceled() const
+{
+    if (!m_state) return true;
+
+    QMutexLocker locker{&m_state->mutex};
+    if (m_state->finished) return true;
+    return m_state->isCanceled && m_state->isCanceled();
+}
+
+void
+EvalPromise::setNodeData(PortId portId, NodeDataPtr data)
+{
+    if (!m_state) return;
+
+    QMutexLocker locker{&m_state->mutex};
+    if (m_state->finished) return;
+
+    auto& outData = m_state->data;
+    auto iter = std::find_if(outData.begin(), outData.end(),
+                             [portId](auto const& entry){
+        return entry.first == portId;
+    });
+
+    if (iter != outData.end())
+    {
+        iter->second = std::move(data);
+        return;
+    }
+    outData.push_back({portId, std::move(data)});
+}
+
+void
+EvalPromise::finish()
+{
+    if (m_state) m_state->complete(true);
+}
+
+void
+EvalPromise::fail()
+{
+    if (m_state) m_state->complete(false);
+}
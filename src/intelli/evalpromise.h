@@ -0,0 +1,106 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_EVALPROMISE_H
+#define GT_INTELLI_EVALPROMISE_H
+
+#include <intelli/exports.h>
+#include <intelli/nodedatainterface.h>
+
+#include <functional>
+#include <memory>
+
+namespace intelli
+{
+
+class AsyncExecutor;
+class INode;
+
+/**
+ * @brief The EvalPromise class. Handle to complete the asynchronous evaluation
+ * of a node (see `NodeEvalMode::Async` and `Node::evalAsync`). The node starts
+ * its work (e.g. file I/O or an external process) and completes the promise
+ * later, thus no thread is occupied while waiting. The promise may be copied
+ * and completed from any thread, the outputs are transferred to the exec
+ * model in the thread of the node. Only the first completion is considered.
+ * The evaluation fails if all copies are destroyed without completing it.
+ */
+class GT_INTELLI_EXPORT EvalPromise
+{
+public:
+
+    /// Callback that is invoked once the promise is completed
+    using Callback = std::function<void(NodeDataPtrList data, bool success)>;
+
+    /// Constructs an invalid promise
+    EvalPromise();
+
+    /**
+     * @brief Returns whether the promise is valid, i.e. belongs to an
+     * evaluation.
+     * @return Is valid
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Returns whether the promise was completed already.
+     * @return Is finished
+     */
+    bool isFinished() const;
+
+    /**
+     * @brief Returns whether the evaluation was canceled, i.e. its results
+     * are no longer needed. The node should abort its work and complete the
+     * promise. Returns true once the promise is finished.
+     * @return Is canceled
+     */
+    bool isCanceled() const;
+
+    /**
+     * @brief Sets the data of an output port. The data is transferred once
+     * the promise is completed successfully.
+     * @param portId Output port
+     * @param data Data to set
+     */
+    void setNodeData(PortId portId, NodeDataPtr data);
+
+    /**
+     * @brief Completes the evaluation successfully.
+     */
+    void finish();
+
+    /**
+     * @brief Completes the evaluation and marks the node as failed. The
+     * output data is discarded.
+     */
+    void fail();
+
+private:
+
+    struct State;
+    std::shared_ptr<State> m_state;
+
+    /**
+     * @brief Creates a valid promise
+     * @param isCanceled Predicate that is polled by `isCanceled`. Must remain
+     * valid until the promise is finished.
+     * @param onFinished Callback that is invoked once the promise is
+     * completed. May be invoked from any thread.
+     * @return Promise
+     */
+    static EvalPromise make(std::function<bool()> isCanceled,
+                            Callback onFinished);
+
+    friend class AsyncExecutor;
+    friend class INode;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_EVALPROMISE_H
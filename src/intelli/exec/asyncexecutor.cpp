@@ -0,0 +1,150 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/exec/asyncexecutor.h"
+
+#include "intelli/node.h"
+#include "intelli/private/utils.h"
+
+#include <gt_utilities.h>
+
+#include <QMutex>
+
+using namespace intelli;
+
+struct AsyncExecutor::Receiver
+{
+    QMutex mutex;
+    /// executor to notify (null once the executor was destroyed)
+    AsyncExecutor* executor = nullptr;
+};
+
+AsyncExecutor::AsyncExecutor(QObject* parent) :
+    QObject(parent)
+{
+
+}
+
+AsyncExecutor::~AsyncExecutor()
+{
+    if (!m_receiver) return;
+
+    // a pending completion must not access this object
+    QMutexLocker locker{&m_receiver->mutex};
+    m_receiver->executor = nullptr;
+}
+
+bool
+AsyncExecutor::canEvaluateNode()
+{
+    return !m_receiver;
+}
+
+bool
+AsyncExecutor::cancel()
+{
+    if (!m_receiver) return false;
+
+    *m_token = true;
+    return true;
+}
+
+void
+AsyncExecutor::onEvaluationFinished(NodeDataPtrList const& data, bool success)
+{
+    m_receiver.reset();
+
+    if (!m_node)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to transfer node data! (Invalid node)");
+        return;
+    }
+
+    auto finally = gt::finally([this](){
+        if (m_node) emit m_node->computingFinished();
+    });
+    Q_UNUSED(finally);
+
+#ifdef GT_INTELLI_DEBUG_NODE_EXEC
+    gtTrace().verbose()
+        << utils::logId(this)
+        << tr("collecting data from node '%1' (%2)...")
+               .arg(relativeNodePath(*m_node))
+               .arg(m_node->id());
+#endif
+
+    auto* model = exec::nodeDataInterface(*m_node);
+    if (!model)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to transfer node data! (Missing data interface)");
+        return;
+    }
+
+    NodeUuid const& nodeUuid = m_node->uuid();
+
+    // results of a canceled evaluation are outdated and thus discarded
+    if (!*m_token)
+    {
+        if (!success) model->setNodeEvaluationFailed(nodeUuid);
+
+        if (!data.empty() && !model->setNodeData(nodeUuid, PortType::Out, data))
+        {
+            gtError() << utils::logId(this)
+                      << tr("Failed to transfer node data!");
+        }
+    }
+
+    finally.finalize();
+
+    model->nodeEvaluationFinished(nodeUuid);
+}
+
+EvalPromise
+AsyncExecutor::evaluateNode(Node& node)
+{
+    NodeDataInterface* model = exec::nodeDataInterface(node);
+    assert(model);
+
+    if (!canEvaluateNode())
+    {
+        gtWarning() << utils::logId(this)
+                    << tr("Failed to evaluate node '%1'! (Node is already running)")
+                           .arg(node.objectName());
+        return {};
+    }
+
+    m_node = &node;
+    m_token = std::make_shared<std::atomic<bool>>(false);
+    m_receiver = std::make_shared<Receiver>();
+    m_receiver->executor = this;
+
+    model->nodeEvaluationStarted(node.uuid());
+    emit m_node->computingStarted();
+
+    auto isCanceled = [token = m_token](){
+        return token->load();
+    };
+
+    auto onFinished = [receiver = m_receiver](NodeDataPtrList data, bool success){
+        QMutexLocker locker{&receiver->mutex};
+
+        AsyncExecutor* executor = receiver->executor;
+        if (!executor) return;
+
+        // the promise may be completed in any thread, thus the results are
+        // always transferred in the thread of the executor
+        QMetaObject::invokeMethod(executor, [executor, data = std::move(data), success](){
+            executor->onEvaluationFinished(data, success);
+        }, Qt::QueuedConnection);
+    };
+
+    return EvalPromise::make(std::move(isCanceled), std::move(onFinished));
+}
@@ -0,0 +1,74 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ASYNCEXECUTOR_H
+#define GT_INTELLI_ASYNCEXECUTOR_H
+
+#include <intelli/globals.h>
+#include <intelli/evalpromise.h>
+
+#include <QObject>
+#include <QPointer>
+
+namespace intelli
+{
+
+class Node;
+
+/**
+ * @brief The AsyncExecutor class.
+ * Tracks the asynchronous evaluation of a node (see `Node::evalAsync`). No
+ * thread is occupied during the evaluation, the promise may be completed from
+ * any thread. The results are transferred to the node data interface in the
+ * thread of the executor.
+ */
+class AsyncExecutor : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    AsyncExecutor(QObject* parent = nullptr);
+    ~AsyncExecutor();
+
+    /**
+     * @brief Marks the node as evaluating and creates the promise to complete
+     * the evaluation with.
+     * @param node Node to evaluate
+     * @return Promise (invalid if the node cannot be evaluated)
+     */
+    EvalPromise evaluateNode(Node& node);
+
+    bool canEvaluateNode();
+
+    /**
+     * @brief Requests the cancellation of the running evaluation. The results
+     * of the evaluation are discarded once the promise is completed.
+     * @return Whether an evaluation was running
+     */
+    bool cancel();
+
+private:
+
+    /// Receiver of the completion, which may outlive the executor
+    struct Receiver;
+
+    QPointer<Node> m_node;
+
+    /// receiver of the running evaluation
+    std::shared_ptr<Receiver> m_receiver;
+
+    CancellationToken m_token;
+
+    void onEvaluationFinished(NodeDataPtrList const& data, bool success);
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ASYNCEXECUTOR_H
@@ -185,6 +185,15 @@ DetachedExecutor::canEvaluateNode()
     return m_collected && !m_destroyed;
 }
 
+bool
+DetachedExecutor::cancel()
+{
+    if (m_collected || !m_token) return false;
+
+    *m_token = true;
+    return true;
+}
+
 void
 DetachedExecutor::onFinished()
 {
@@ -240,6 +249,9 @@ DetachedExecutor::onResultReady(int result)
 
     m_collected = true;
 
+    bool canceled = m_token && *m_token;
+    m_token.reset();
+
     auto* model = exec::nodeDataInterface(*m_node);
     if (!model)
     {
@@ -250,12 +262,16 @@ DetachedExecutor::onResultReady(int result)
 
     NodeUuid const& nodeUuid = m_node->uuid();
 
-    if (!returnValue.success) model->setNodeEvaluationFailed(nodeUuid);
-
-    if (!model->setNodeData(nodeUuid, PortType::Out, outData))
+    // results of a canceled evaluation are outdated and thus discarded
+    if (!canceled)
     {
-        gtError() << utils::logId(this)
-                  << tr("Failed to transfer node data!");
+        if (!returnValue.success) model->setNodeEvaluationFailed(nodeUuid);
+
+        if (!model->setNodeData(nodeUuid, PortType::Out, outData))
+        {
+            gtError() << utils::logId(this)
+                      << tr("Failed to transfer node data!");
+        }
     }
 
     finally.finalize();
@@ -290,6 +306,7 @@ DetachedExecutor::evaluateNode(Node& node)
 
     m_node = &node;
     m_collected = false;
+    m_token = std::make_shared<std::atomic<bool>>(false);
     emit m_node->computingStarted();
 
     NodeUuid const& nodeUuid = node.uuid();
@@ -305,6 +322,7 @@ DetachedExecutor::evaluateNode(Node& node)
                 targetMetaObject = node.metaObject(),
                 targetObject = QPointer<Node>(&node),
                 executor = this,
+                token = m_token,
                 userVariables,
                 scope
                 ]() -> ReturnValue
@@ -352,6 +370,7 @@ DetachedExecutor::evaluateNode(Node& node)
             DummyNodeDataModel model{*node};
             model.setUserVariables(userVariables);
             model.setScope(scope);
+            model.setCancellationToken(token);
 
             bool success = true;
             success &= model.setNodeData(PortType::In,  inData);
@@ -39,6 +39,13 @@ public:
 
     bool canEvaluateNode();
 
+    /**
+     * @brief Requests the cancellation of the running evaluation. The results
+     * of the evaluation are discarded once it finishes.
+     * @return Whether an evaluation was running
+     */
+    bool cancel();
+
 private:
     
     QPointer<Node> m_node;
@@ -51,6 +58,9 @@ private:
 
     QFutureWatcher<ReturnValue> m_watcher;
 
+    /// token of the running evaluation
+    CancellationToken m_token;
+
     bool m_collected = true;
     bool m_destroyed = false;
 
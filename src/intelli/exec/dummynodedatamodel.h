@@ -59,12 +59,17 @@ public:
 
     void setScope(GtObject* scope) { m_scope = scope; }
 
+    bool isEvaluationCanceled(NodeUuid const& nodeUuid) const override { return m_token && *m_token; }
+
+    void setCancellationToken(CancellationToken token) { m_token = std::move(token); }
+
 private:
 
     Node* m_node = nullptr;
     data_model::DataItem m_data;
     QPointer<GtObject> m_scope;
     QPointer<GraphUserVariables const> m_userVariables;
+    CancellationToken m_token;
     bool m_success = true;
 };
 
@@ -0,0 +1,165 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/exec/processexecutor.h"
+
+#include "intelli/node.h"
+#include "intelli/graphuservariables.h"
+#include "intelli/exec/workerpool.h"
+#include "intelli/private/utils.h"
+
+#include <gt_objectmemento.h>
+#include <gt_utilities.h>
+
+using namespace intelli;
+
+ProcessExecutor::ProcessExecutor(QObject* parent) :
+    QObject(parent)
+{
+
+}
+
+ProcessExecutor::~ProcessExecutor()
+{
+    if (m_jobId == 0) return;
+
+    if (auto* pool = WorkerPool::instance()) pool->cancel(m_jobId);
+}
+
+bool
+ProcessExecutor::canEvaluateNode()
+{
+    return m_jobId == 0;
+}
+
+bool
+ProcessExecutor::cancel()
+{
+    if (m_jobId == 0) return false;
+
+    auto* pool = WorkerPool::instance();
+    if (!pool) return false;
+
+    m_canceled = true;
+    pool->cancel(m_jobId);
+    return true;
+}
+
+void
+ProcessExecutor::onJobFinished(NodeDataPtrList const& data, bool success)
+{
+    m_jobId = 0;
+
+    if (!m_node)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to transfer node data! (Invalid node)");
+        return;
+    }
+
+    auto finally = gt::finally([this](){
+        if (m_node) emit m_node->computingFinished();
+    });
+    Q_UNUSED(finally);
+
+#ifdef GT_INTELLI_DEBUG_NODE_EXEC
+    gtTrace().verbose()
+        << utils::logId(this)
+        << tr("collecting data from node '%1' (%2)...")
+               .arg(relativeNodePath(*m_node))
+               .arg(m_node->id());
+#endif
+
+    auto* model = exec::nodeDataInterface(*m_node);
+    if (!model)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to transfer node data! (Missing data interface)");
+        return;
+    }
+
+    NodeUuid const& nodeUuid = m_node->uuid();
+
+    // results of a canceled evaluation are outdated and thus discarded
+    if (!m_canceled)
+    {
+        if (!success) model->setNodeEvaluationFailed(nodeUuid);
+
+        if (!model->setNodeData(nodeUuid, PortType::Out, data))
+        {
+            gtError() << utils::logId(this)
+                      << tr("Failed to transfer node data!");
+        }
+    }
+
+    finally.finalize();
+
+    model->nodeEvaluationFinished(nodeUuid);
+}
+
+bool
+ProcessExecutor::evaluateNode(Node& node)
+{
+    NodeDataInterface* model = exec::nodeDataInterface(node);
+    assert(model);
+
+    if (!canEvaluateNode())
+    {
+        gtWarning() << utils::logId(this)
+                    << tr("Failed to evaluate node '%1'! (Node is already running)")
+                           .arg(node.objectName());
+        return false;
+    }
+
+    auto* pool = WorkerPool::instance();
+    if (!pool)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to evaluate node '%1'! (Missing application instance)")
+                         .arg(node.objectName());
+        return false;
+    }
+
+    NodeUuid const& nodeUuid = node.uuid();
+
+    WorkerPool::Request request;
+    request.memento = node.toMemento().toByteArray();
+    request.inData  = model->nodeData(nodeUuid, PortType::In);
+    request.outData = model->nodeData(nodeUuid, PortType::Out);
+
+    if (auto* userVariables = model->userVariables())
+    {
+        userVariables->visit([&request](QString const& key, QVariant const& value){
+            request.userVariables.insert(key, value);
+        });
+    }
+
+    QPointer<ProcessExecutor> executor = this;
+    WorkerPool::JobId jobId = pool->submit(request, [executor](WorkerPool::Response response){
+        if (executor) executor->onJobFinished(response.data, response.success);
+    });
+
+    if (jobId == 0)
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to evaluate node '%1'! (Node data cannot be "
+                        "transferred to the worker process)")
+                         .arg(node.objectName());
+        return false;
+    }
+
+    m_node = &node;
+    m_jobId = jobId;
+    m_canceled = false;
+
+    model->nodeEvaluationStarted(nodeUuid);
+    emit m_node->computingStarted();
+
+    return true;
+}
@@ -0,0 +1,64 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_PROCESSEXECUTOR_H
+#define GT_INTELLI_PROCESSEXECUTOR_H
+
+#include <intelli/globals.h>
+#include <intelli/nodedatainterface.h>
+
+#include <QObject>
+#include <QPointer>
+
+namespace intelli
+{
+
+class Node;
+
+/**
+ * @brief The ProcessExecutor class.
+ * Executes a node in a separate worker process (see `WorkerPool`) to allow
+ * the parallel evaluation of nodes that are not thread-safe. A crashing node
+ * only terminates the worker process.
+ */
+class ProcessExecutor : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    ProcessExecutor(QObject* parent = nullptr);
+    ~ProcessExecutor();
+
+    bool evaluateNode(Node& node);
+
+    bool canEvaluateNode();
+
+    /**
+     * @brief Requests the cancellation of the running evaluation. The worker
+     * process is terminated and the results of the evaluation are discarded.
+     * @return Whether an evaluation was running
+     */
+    bool cancel();
+
+private:
+
+    QPointer<Node> m_node;
+
+    /// job of the running evaluation
+    quint64 m_jobId = 0;
+
+    bool m_canceled = false;
+
+    void onJobFinished(NodeDataPtrList const& data, bool success);
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_PROCESSEXECUTOR_H
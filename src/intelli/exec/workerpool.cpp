@@ -0,0 +1,923 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/exec/workerpool.h"
+
+#include "intelli/node.h"
+#include "intelli/nodedatafactory.h"
+#include "intelli/graphuservariables.h"
+#include "intelli/exec/dummynodedatamodel.h"
+#include "intelli/private/utils.h"
+
+#include <gt_objectfactory.h>
+#include <gt_objectmemento.h>
+#include <gt_qtutilities.h>
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLockFile>
+#include <QPointer>
+#include <QProcess>
+#include <QSharedMemory>
+#include <QThread>
+
+#include <deque>
+#include <iostream>
+#include <string>
+
+using namespace intelli;
+
+namespace
+{
+
+/// version of the serialized requests and responses
+constexpr quint32 s_version = 1;
+
+/// command sent to the worker to start a job, followed by the key and the size
+/// of the shared memory segment holding the request
+QByteArray const s_jobCommand = QByteArrayLiteral("intelli::worker::job");
+/// command sent by the worker once a job finished, followed by the key and the
+/// size of the shared memory segment holding the response
+QByteArray const s_resultCommand = QByteArrayLiteral("intelli::worker::result");
+
+/// prefix of the shared memory segments and the segment registry files
+QString const s_segmentPrefix = QStringLiteral("intelli_worker_");
+/// suffix of the shared memory segments holding a response
+QString const s_responseSuffix = QStringLiteral("_response");
+
+/// file name of the worker executable
+QString const s_workerName = QStringLiteral("GTlabIntelliGraphWorker");
+/// environment variable to override the path of the worker executable
+char const* s_workerEnv = "GT_INTELLI_WORKER";
+
+bool
+writeData(QDataStream& stream, NodeDataPtrList const& data)
+{
+    auto& factory = NodeDataFactory::instance();
+
+    stream << (quint32)data.size();
+    for (auto const& entry : data)
+    {
+        stream << entry.first.value();
+        if (!factory.serialize(entry.second, stream)) return false;
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+bool
+readData(QDataStream& stream, NodeDataPtrList& data)
+{
+    auto& factory = NodeDataFactory::instance();
+
+    quint32 size = 0;
+    stream >> size;
+    if (stream.status() != QDataStream::Ok) return false;
+
+    data.clear();
+    data.reserve(size);
+    for (quint32 i = 0; i < size; ++i)
+    {
+        PortId::value_type portId{};
+        stream >> portId;
+
+        auto entry = factory.deserialize(stream);
+        if (!entry) return false;
+
+        data.push_back({PortId(portId), std::move(*entry)});
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+/// parses the arguments of a command, i.e. the key and the size of a shared
+/// memory segment
+bool
+parseCommand(QByteArray const& line, QByteArray const& command,
+             QString& key, int& size)
+{
+    if (!line.startsWith(command)) return false;
+
+    QList<QByteArray> args = line.mid(command.size()).trimmed().split(' ');
+    if (args.size() != 2) return false;
+
+    bool ok = true;
+    key  = QString::fromUtf8(args.at(0));
+    size = args.at(1).toInt(&ok);
+    return ok && !key.isEmpty() && size > 0;
+}
+
+/// copies the content of the shared memory segment `key`
+bool
+readSegment(QString const& key, int size, QByteArray& bytes)
+{
+    QSharedMemory segment(key);
+    if (!segment.attach(QSharedMemory::ReadOnly) || segment.size() < size)
+    {
+        return false;
+    }
+
+    segment.lock();
+    bytes = QByteArray(static_cast<char const*>(segment.constData()), size);
+    segment.unlock();
+    return true;
+}
+
+/// removes the shared memory segment `key` if no process is attached to it
+/// anymore, e.g. because its owner crashed. SysV segments are not destroyed
+/// together with their owner, detaching the last attachment destroys them.
+void
+releaseSegment(QString const& key)
+{
+    QSharedMemory segment(key);
+    if (segment.attach()) segment.detach();
+}
+
+/// creates the shared memory segment `key` holding `bytes`
+std::unique_ptr<QSharedMemory>
+writeSegment(QString const& key, QByteArray const& bytes)
+{
+    auto segment = std::make_unique<QSharedMemory>(key);
+    if (!segment->create(bytes.size()))
+    {
+        if (segment->error() != QSharedMemory::AlreadyExists) return nullptr;
+
+        // segment may have been left behind by a crashed process
+        releaseSegment(key);
+        if (!segment->create(bytes.size())) return nullptr;
+    }
+
+    segment->lock();
+    std::copy(bytes.begin(), bytes.end(), static_cast<char*>(segment->data()));
+    segment->unlock();
+    return segment;
+}
+
+} // namespace
+
+struct WorkerPool::Impl
+{
+    /// Job of the pool
+    struct Job
+    {
+        /// id of the job, zero denotes an invalid job
+        JobId id = 0;
+        /// serialized request
+        QByteArray request;
+        /// callback to invoke once the job finished
+        Callback callback;
+    };
+
+    /// Worker process
+    struct Worker
+    {
+        QPointer<QProcess> process;
+        /// segment holding the request of the running job
+        std::unique_ptr<QSharedMemory> segment;
+        /// key of the segments of the last job
+        QString key;
+        /// running job
+        Job job;
+        /// whether the running job was canceled
+        bool canceled = false;
+
+        bool isIdle() const { return job.id == 0; }
+    };
+
+    /// program to launch, resolved on demand if empty
+    QString program;
+    /// arguments of the program
+    QStringList arguments;
+    /// lock of the segment registry of this process, marks the registered
+    /// segments as in use
+    std::unique_ptr<QLockFile> registryLock;
+    /// max. number of workers
+    size_t maxWorkerCount = std::max(1, QThread::idealThreadCount());
+    /// running workers
+    std::vector<std::unique_ptr<Worker>> workers;
+    /// pending jobs
+    std::deque<Job> queue;
+    /// id of the next job
+    JobId nextId = 1;
+
+    /// invokes the callback of the job asynchronously
+    static void
+    finishJob(WorkerPool& pool, Job job, Response response)
+    {
+        if (!job.callback) return;
+
+        QMetaObject::invokeMethod(&pool, [callback = std::move(job.callback),
+                                          response = std::move(response)](){
+            callback(std::move(response));
+        }, Qt::QueuedConnection);
+    }
+
+    /// returns the path of the registry file of the process `pid` using the
+    /// given suffix
+    static QString
+    registryPath(qint64 pid, QString const& suffix)
+    {
+        return QDir(QDir::tempPath()).filePath(s_segmentPrefix +
+                                               QString::number(pid) + suffix);
+    }
+
+    /// writes the keys of the segments that may be in use to the registry of
+    /// this process. Allows to release the segments on the next start if this
+    /// process crashes.
+    static void
+    updateRegistry(WorkerPool& pool)
+    {
+        if (!pool.pimpl->registryLock) return;
+
+        QFile file(registryPath(QCoreApplication::applicationPid(),
+                                QStringLiteral(".segments")));
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) return;
+
+        for (auto const& worker : pool.pimpl->workers)
+        {
+            if (worker->key.isEmpty()) continue;
+            file.write(worker->key.toUtf8() + '\n');
+        }
+    }
+
+    /// releases the segments registered by processes that are no longer
+    /// running and registers this process
+    static void
+    initRegistry(WorkerPool& pool)
+    {
+        QDir dir(QDir::tempPath());
+        auto const files = dir.entryInfoList({s_segmentPrefix + "*.segments"},
+                                             QDir::Files);
+        for (QFileInfo const& info : files)
+        {
+            QLockFile lock(dir.filePath(info.completeBaseName() + ".lock"));
+            // only the owning process is checked, not the age of the lock
+            lock.setStaleLockTime(0);
+            if (!lock.tryLock(0)) continue;
+
+            QFile file(info.absoluteFilePath());
+            if (file.open(QIODevice::ReadOnly))
+            {
+                while (!file.atEnd())
+                {
+                    QString key = QString::fromUtf8(file.readLine().trimmed());
+                    if (key.isEmpty()) continue;
+
+                    releaseSegment(key);
+                    releaseSegment(key + s_responseSuffix);
+                }
+                file.close();
+            }
+            file.remove();
+        }
+
+        auto lock = std::make_unique<QLockFile>(
+            registryPath(QCoreApplication::applicationPid(),
+                         QStringLiteral(".lock")));
+        lock->setStaleLockTime(0);
+        if (lock->tryLock(0)) pool.pimpl->registryLock = std::move(lock);
+    }
+
+    /// releases the segments of the last job of the worker. Must only be
+    /// called once the process is no longer running.
+    static void
+    releaseSegments(Worker& worker)
+    {
+        worker.segment.reset();
+        if (worker.key.isEmpty()) return;
+
+        releaseSegment(worker.key);
+        releaseSegment(worker.key + s_responseSuffix);
+        worker.key.clear();
+    }
+
+    /// returns the worker program. Unless set explicitly, the program is
+    /// searched next to the module, next to the application and in the path
+    /// given by the environment variable `GT_INTELLI_WORKER`.
+    static QString
+    resolveProgram(WorkerPool& pool)
+    {
+        auto& self = *pool.pimpl;
+        if (!self.program.isEmpty()) return self.program;
+
+        QDir appDir(QCoreApplication::applicationDirPath());
+
+        QStringList candidates;
+        QString env = qEnvironmentVariable(s_workerEnv);
+        if (!env.isEmpty()) candidates << env;
+        // worker is installed alongside the module
+        candidates << appDir.filePath(QStringLiteral("modules/") + s_workerName)
+                   << appDir.filePath(s_workerName);
+
+        for (QString const& candidate : qAsConst(candidates))
+        {
+#ifdef Q_OS_WIN
+            QFileInfo info(candidate.endsWith(".exe") ? candidate :
+                                                        candidate + ".exe");
+#else
+            QFileInfo info(candidate);
+#endif
+            if (info.isFile() && info.isExecutable())
+            {
+                return self.program = info.absoluteFilePath();
+            }
+        }
+
+        gtError() << utils::logId<WorkerPool>()
+                  << tr("Worker program '%1' not found! Searched: %2. "
+                        "Set the path using 'exec::setWorkerProgram' or the "
+                        "environment variable '%3'.")
+                         .arg(s_workerName, candidates.join(", "),
+                              QString::fromLatin1(s_workerEnv));
+        return {};
+    }
+
+    /// launches a new worker process
+    static Worker*
+    launchWorker(WorkerPool& pool)
+    {
+        QString program = resolveProgram(pool);
+        if (program.isEmpty()) return nullptr;
+
+        auto* process = new QProcess(&pool);
+        process->setProgram(program);
+        process->setArguments(pool.pimpl->arguments);
+        // log output of the worker is forwarded
+        process->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+
+        auto worker = std::make_unique<Worker>();
+        worker->process = process;
+        Worker* w = worker.get();
+
+        QObject::connect(process, &QProcess::readyReadStandardOutput,
+                         &pool, [&pool, w](){ onReadyRead(pool, *w); });
+        QObject::connect(process, qOverload<int, QProcess::ExitStatus>(&QProcess::finished),
+                         &pool, [&pool, w](int exitCode, QProcess::ExitStatus){
+            onWorkerExited(pool, *w, tr("(exit code: %1)").arg(exitCode));
+        });
+        QObject::connect(process, &QProcess::errorOccurred,
+                         &pool, [&pool, process](QProcess::ProcessError error){
+            // other errors are followed by the finished signal
+            if (error != QProcess::FailedToStart) return;
+
+            // the error may be emitted while the worker is launched
+            QMetaObject::invokeMethod(&pool, [&pool, p = QPointer<QProcess>(process)](){
+                Worker* w = findWorker(pool, p);
+                if (!w) return;
+
+                onWorkerExited(pool, *w, tr("(failed to start '%1')")
+                                             .arg(p->program()));
+            }, Qt::QueuedConnection);
+        });
+
+#ifdef GT_INTELLI_DEBUG_NODE_EXEC
+        gtTrace().verbose()
+            << utils::logId<WorkerPool>()
+            << tr("launching worker process '%1'...").arg(process->program());
+#endif
+
+        pool.pimpl->workers.push_back(std::move(worker));
+        process->start(QIODevice::ReadWrite);
+        return w;
+    }
+
+    /// returns the worker of the process
+    static Worker*
+    findWorker(WorkerPool& pool, QProcess const* process)
+    {
+        if (!process) return nullptr;
+
+        auto& workers = pool.pimpl->workers;
+        auto iter = std::find_if(workers.begin(), workers.end(),
+                                 [process](auto const& w){
+            return w->process == process;
+        });
+        return iter != workers.end() ? iter->get() : nullptr;
+    }
+
+    /// removes the worker from the pool, the process is terminated
+    static void
+    removeWorker(WorkerPool& pool, Worker& worker)
+    {
+        auto& workers = pool.pimpl->workers;
+        auto iter = std::find_if(workers.begin(), workers.end(),
+                                 [&worker](auto const& w){
+            return w.get() == &worker;
+        });
+        if (iter == workers.end()) return;
+
+        auto removed = std::move(*iter);
+        workers.erase(iter);
+
+        if (QProcess* process = removed->process)
+        {
+            process->disconnect(&pool);
+            if (process->state() != QProcess::NotRunning)
+            {
+                process->kill();
+                process->waitForFinished(1000);
+            }
+            process->deleteLater();
+        }
+
+        releaseSegments(*removed);
+        updateRegistry(pool);
+    }
+
+    /// starts the next pending jobs as long as workers are available
+    static void
+    dispatch(WorkerPool& pool)
+    {
+        auto& self = *pool.pimpl;
+
+        while (!self.queue.empty())
+        {
+            auto iter = std::find_if(self.workers.begin(), self.workers.end(),
+                                     [](auto const& w){ return w->isIdle(); });
+
+            Worker* worker = nullptr;
+            if (iter != self.workers.end()) worker = iter->get();
+            else if (self.workers.size() < self.maxWorkerCount)
+            {
+                worker = launchWorker(pool);
+                if (!worker)
+                {
+                    // no worker can be launched, fail all pending jobs
+                    while (!self.queue.empty())
+                    {
+                        Job job = std::move(self.queue.front());
+                        self.queue.pop_front();
+                        finishJob(pool, std::move(job), {});
+                    }
+                    return;
+                }
+            }
+            if (!worker) return;
+
+            Job job = std::move(self.queue.front());
+            self.queue.pop_front();
+
+            startJob(pool, *worker, std::move(job));
+        }
+    }
+
+    /// transfers the request of the job to the worker
+    static void
+    startJob(WorkerPool& pool, Worker& worker, Job job)
+    {
+        QString key = s_segmentPrefix + QStringLiteral("%1_%2")
+                          .arg(QCoreApplication::applicationPid())
+                          .arg(job.id);
+
+        auto segment = writeSegment(key, job.request);
+        if (!segment)
+        {
+            gtError() << utils::logId<WorkerPool>()
+                      << tr("Failed to create shared memory segment for job %1!")
+                             .arg(job.id);
+            return finishJob(pool, std::move(job), {});
+        }
+
+        int size = job.request.size();
+
+        worker.segment = std::move(segment);
+        worker.key = key;
+        worker.job = std::move(job);
+        worker.job.request.clear();
+        worker.canceled = false;
+
+        updateRegistry(pool);
+
+        worker.process->write(s_jobCommand + ' ' + key.toUtf8() + ' ' +
+                              QByteArray::number(size) + '\n');
+    }
+
+    /// collects the response of the running job
+    static void
+    onReadyRead(WorkerPool& pool, Worker& worker)
+    {
+        while (worker.process && worker.process->canReadLine())
+        {
+            QByteArray line = worker.process->readLine().trimmed();
+            if (!line.startsWith(s_resultCommand))
+            {
+                // forward output of the worker
+                if (!line.isEmpty()) gtDebug() << utils::logId<WorkerPool>() << line;
+                continue;
+            }
+
+            if (worker.isIdle()) continue;
+
+            Response response;
+
+            QString key;
+            int size = 0;
+            QByteArray bytes;
+            if (!parseCommand(line, s_resultCommand, key, size) ||
+                !readSegment(key, size, bytes))
+            {
+                gtError() << utils::logId<WorkerPool>()
+                          << tr("Failed to collect the response of job %1!")
+                                 .arg(worker.job.id);
+            }
+            else
+            {
+                QDataStream stream(bytes);
+                if (!readResponse(stream, response))
+                {
+                    gtError() << utils::logId<WorkerPool>()
+                              << tr("Failed to deserialize the response of job %1!")
+                                     .arg(worker.job.id);
+                    response = {};
+                }
+            }
+
+            worker.segment.reset();
+            finishJob(pool, std::move(worker.job), std::move(response));
+            worker.job = {};
+        }
+
+        dispatch(pool);
+    }
+
+    /// fails the running job of the worker and removes the worker. The
+    /// segments of the worker are released, as a crashed worker cannot
+    /// release its response.
+    static void
+    onWorkerExited(WorkerPool& pool, Worker& worker, QString const& reason)
+    {
+        if (!worker.isIdle() && !worker.canceled)
+        {
+            gtError() << utils::logId<WorkerPool>()
+                      << tr("Worker process terminated unexpectedly while "
+                            "evaluating job %1!").arg(worker.job.id)
+                      << reason;
+        }
+
+        Job job = std::move(worker.job);
+        worker.job = {};
+
+        removeWorker(pool, worker);
+
+        if (job.id != 0) finishJob(pool, std::move(job), {});
+
+        dispatch(pool);
+    }
+};
+
+WorkerPool::WorkerPool(QObject* parent) :
+    QObject(parent),
+    pimpl(std::make_unique<Impl>())
+{
+    Impl::initRegistry(*this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    // workers terminate once their input is closed
+    for (auto& worker : pimpl->workers)
+    {
+        QProcess* process = worker->process;
+        if (process)
+        {
+            process->disconnect(this);
+            process->closeWriteChannel();
+            if (!process->waitForFinished(1000))
+            {
+                process->kill();
+                process->waitForFinished(1000);
+            }
+        }
+
+        Impl::releaseSegments(*worker);
+    }
+
+    if (pimpl->registryLock)
+    {
+        QFile::remove(Impl::registryPath(QCoreApplication::applicationPid(),
+                                         QStringLiteral(".segments")));
+        pimpl->registryLock->unlock();
+    }
+}
+
+WorkerPool*
+WorkerPool::instance()
+{
+    static QPointer<WorkerPool> self;
+
+    if (!self)
+    {
+        auto* app = QCoreApplication::instance();
+        if (!app) return nullptr;
+
+        self = new WorkerPool(app);
+    }
+    return self;
+}
+
+void
+WorkerPool::setProgram(QString program, QStringList arguments)
+{
+    pimpl->program = std::move(program);
+    pimpl->arguments = std::move(arguments);
+}
+
+void
+WorkerPool::setMaxWorkerCount(size_t count)
+{
+    pimpl->maxWorkerCount = count > 0 ? count :
+                                        std::max(1, QThread::idealThreadCount());
+
+    Impl::dispatch(*this);
+}
+
+size_t
+WorkerPool::maxWorkerCount() const
+{
+    return pimpl->maxWorkerCount;
+}
+
+WorkerPool::JobId
+WorkerPool::submit(Request const& request, Callback callback)
+{
+    Impl::Job job;
+
+    QDataStream stream(&job.request, QIODevice::WriteOnly);
+    if (!writeRequest(stream, request))
+    {
+        gtError() << utils::logId(this)
+                  << tr("Failed to serialize the request!");
+        return 0;
+    }
+
+    job.id = pimpl->nextId++;
+    job.callback = std::move(callback);
+
+    JobId jobId = job.id;
+    pimpl->queue.push_back(std::move(job));
+
+    // jobs are dispatched asynchronously, such that the callback is never
+    // invoked before this function returns
+    QMetaObject::invokeMethod(this, [this](){
+        Impl::dispatch(*this);
+    }, Qt::QueuedConnection);
+
+    return jobId;
+}
+
+bool
+WorkerPool::cancel(JobId jobId)
+{
+    auto& queue = pimpl->queue;
+    auto iter = std::find_if(queue.begin(), queue.end(),
+                             [jobId](Impl::Job const& job){
+        return job.id == jobId;
+    });
+    if (iter != queue.end())
+    {
+        Impl::Job job = std::move(*iter);
+        queue.erase(iter);
+        Impl::finishJob(*this, std::move(job), {});
+        return true;
+    }
+
+    for (auto& worker : pimpl->workers)
+    {
+        if (worker->job.id != jobId) continue;
+
+        // the job is failed once the process terminated
+        worker->canceled = true;
+        if (worker->process) worker->process->kill();
+        return true;
+    }
+
+    return false;
+}
+
+bool
+WorkerPool::writeRequest(QDataStream& stream, Request const& request)
+{
+    stream << s_version << request.memento << request.userVariables;
+    return writeData(stream, request.inData) &&
+           writeData(stream, request.outData);
+}
+
+bool
+WorkerPool::readRequest(QDataStream& stream, Request& request)
+{
+    quint32 version = 0;
+    stream >> version;
+    if (version != s_version) return false;
+
+    stream >> request.memento >> request.userVariables;
+    return readData(stream, request.inData) &&
+           readData(stream, request.outData);
+}
+
+bool
+WorkerPool::writeResponse(QDataStream& stream, Response const& response)
+{
+    stream << s_version << response.success;
+    return writeData(stream, response.data);
+}
+
+bool
+WorkerPool::readResponse(QDataStream& stream, Response& response)
+{
+    quint32 version = 0;
+    stream >> version;
+    if (version != s_version) return false;
+
+    stream >> response.success;
+    return readData(stream, response.data);
+}
+
+void
+intelli::exec::setWorkerProgram(QString const& program,
+                                QStringList const& arguments)
+{
+    auto* pool = WorkerPool::instance();
+    if (!pool)
+    {
+        gtWarning() << utils::logId<WorkerPool>()
+                    << QObject::tr("Failed to set worker program! "
+                                   "(Missing application instance)");
+        return;
+    }
+    pool->setProgram(program, arguments);
+}
+
+void
+intelli::exec::setMaxWorkerCount(size_t count)
+{
+    auto* pool = WorkerPool::instance();
+    if (!pool)
+    {
+        gtWarning() << utils::logId<WorkerPool>()
+                    << QObject::tr("Failed to set max. worker count! "
+                                   "(Missing application instance)");
+        return;
+    }
+    pool->setMaxWorkerCount(count);
+}
+
+size_t
+intelli::exec::maxWorkerCount()
+{
+    auto* pool = WorkerPool::instance();
+    return pool ? pool->maxWorkerCount() : 0;
+}
+
+namespace
+{
+
+/// evaluates the requested node in the current process
+WorkerPool::Response
+evaluateRequest(WorkerPool::Request const& request)
+{
+    auto const makeError = [](){
+        return QObject::tr("Evaluating node in worker process failed!");
+    };
+
+    try
+    {
+        GtObjectMemento memento(request.memento);
+
+        auto node = gt::unique_qobject_cast<Node>(
+            memento.toObject(*gtObjectFactory)
+        );
+        if (!node)
+        {
+            gtError() << utils::logId<WorkerPool>() << makeError()
+                      << QObject::tr("(restoring node '%1' failed)")
+                             .arg(memento.className());
+            return {};
+        }
+
+        GraphUserVariables userVariables;
+        for (auto iter = request.userVariables.begin();
+             iter != request.userVariables.end(); ++iter)
+        {
+            userVariables.setValue(iter.key(), iter.value());
+        }
+
+        DummyNodeDataModel model{*node};
+        model.setUserVariables(&userVariables);
+
+        bool success = true;
+        success &= model.setNodeData(PortType::In,  request.inData);
+        success &= model.setNodeData(PortType::Out, request.outData);
+
+        if (!success)
+        {
+            gtError() << utils::logId<WorkerPool>() << makeError()
+                      << QObject::tr("(failed to copy source data)");
+            return {};
+        }
+
+        exec::blockingEvaluation(*node, &model);
+
+        return WorkerPool::Response{model.nodeData(PortType::Out),
+                                    model.evaluationSuccessful()};
+    }
+    catch (std::exception const& ex)
+    {
+        gtError() << utils::logId<WorkerPool>() << makeError()
+                  << QObject::tr("(caught exception: %1)").arg(ex.what());
+        return {};
+    }
+    catch (...)
+    {
+        gtError() << utils::logId<WorkerPool>() << makeError()
+                  << QObject::tr("(caught unkown exception)");
+        return {};
+    }
+}
+
+} // namespace
+
+int
+intelli::exec::runWorker()
+{
+    if (!QCoreApplication::instance())
+    {
+        gtError() << utils::logId<WorkerPool>()
+                  << QObject::tr("Failed to run worker! "
+                                 "(Missing application instance)");
+        return 1;
+    }
+
+    // the response must remain available until it was collected, i.e. until
+    // the next job is received
+    std::unique_ptr<QSharedMemory> response;
+
+    std::string input;
+    while (std::getline(std::cin, input))
+    {
+        QByteArray line = QByteArray::fromStdString(input).trimmed();
+
+        QString key;
+        int size = 0;
+        if (!parseCommand(line, s_jobCommand, key, size)) continue;
+
+        response.reset();
+
+        WorkerPool::Request request;
+        QByteArray bytes;
+        if (!readSegment(key, size, bytes))
+        {
+            gtError() << utils::logId<WorkerPool>()
+                      << QObject::tr("Failed to read request '%1'!").arg(key);
+        }
+        else
+        {
+            QDataStream stream(bytes);
+            if (!WorkerPool::readRequest(stream, request))
+            {
+                gtError() << utils::logId<WorkerPool>()
+                          << QObject::tr("Failed to deserialize request '%1'!")
+                                 .arg(key);
+                request = {};
+            }
+        }
+
+        WorkerPool::Response result;
+        if (!request.memento.isEmpty()) result = evaluateRequest(request);
+
+        bytes.clear();
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        if (!WorkerPool::writeResponse(stream, result))
+        {
+            // outputs that cannot be serialized are discarded
+            gtError() << utils::logId<WorkerPool>()
+                      << QObject::tr("Failed to serialize response '%1'!")
+                             .arg(key);
+            bytes.clear();
+            QDataStream fallback(&bytes, QIODevice::WriteOnly);
+            WorkerPool::writeResponse(fallback, {});
+        }
+
+        // objects of the evaluation may have been scheduled for deletion
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+        QString responseKey = key + s_responseSuffix;
+        response = writeSegment(responseKey, bytes);
+
+        QByteArray reply = s_resultCommand;
+        if (response)
+        {
+            reply += ' ' + responseKey.toUtf8() + ' ' +
+                     QByteArray::number(bytes.size());
+        }
+        std::cout << reply.toStdString() << std::endl;
+    }
+
+    return 0;
+}
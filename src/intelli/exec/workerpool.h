@@ -0,0 +1,160 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_WORKERPOOL_H
+#define GT_INTELLI_WORKERPOOL_H
+
+#include <intelli/nodedatainterface.h>
+
+#include <QObject>
+#include <QVariantMap>
+
+#include <functional>
+#include <memory>
+
+class QDataStream;
+
+namespace intelli
+{
+
+/**
+ * @brief The WorkerPool class. Manages the worker processes that are used to
+ * evaluate nodes in isolation (see `exec::isolatedEvaluation`). Workers are
+ * launched on demand and reused for subsequent jobs. Jobs are queued if all
+ * workers are busy. The request and the response of a job are exchanged
+ * through shared memory, only the keys of the memory segments are transferred
+ * using the standard input and output of the worker.
+ *
+ * Must only be accessed from the main thread.
+ */
+class WorkerPool : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /// Request to evaluate a single node
+    struct Request
+    {
+        /// memento of the node
+        QByteArray memento;
+        /// input data of the node
+        NodeDataPtrList inData;
+        /// output data of the node
+        NodeDataPtrList outData;
+        /// user variables of the graph
+        QVariantMap userVariables;
+    };
+
+    /// Response of a worker
+    struct Response
+    {
+        /// output data of the node
+        NodeDataPtrList data;
+        /// whether the node was evaluated successfully
+        bool success = false;
+    };
+
+    using JobId = quint64;
+
+    /// Callback that is invoked once a job finished
+    using Callback = std::function<void(Response response)>;
+
+    /**
+     * @brief Returns the instance of the worker pool. The instance is created
+     * on demand and destroyed together with the application instance.
+     * @return Worker pool (null if no application instance exists)
+     */
+    static WorkerPool* instance();
+
+    ~WorkerPool();
+
+    /**
+     * @brief Sets the program that is launched for each worker. By default,
+     * the program `GTlabIntelliGraphWorker` is searched in the path given by
+     * the environment variable `GT_INTELLI_WORKER`, in the module directory
+     * and in the application directory.
+     * @param program Path to the program. An empty path restores the default.
+     * @param arguments Arguments of the program
+     */
+    void setProgram(QString program, QStringList arguments);
+
+    /**
+     * @brief Sets the max. number of worker processes.
+     * @param count Max. number of workers. Zero resets the count to the number
+     * of cores.
+     */
+    void setMaxWorkerCount(size_t count);
+
+    /**
+     * @brief Returns the max. number of worker processes
+     * @return Max. number of workers
+     */
+    size_t maxWorkerCount() const;
+
+    /**
+     * @brief Submits a job to the worker pool. The callback is always invoked
+     * asynchronously, i.e. once the job finished, failed or was canceled.
+     * @param request Request to evaluate
+     * @param callback Callback
+     * @return Id of the job. Zero if the request could not be serialized.
+     */
+    JobId submit(Request const& request, Callback callback);
+
+    /**
+     * @brief Cancels the job. The worker process is terminated if the job is
+     * running already.
+     * @param jobId Job to cancel
+     * @return Whether the job was found
+     */
+    bool cancel(JobId jobId);
+
+    /**
+     * @brief Serializes a request
+     * @param stream Stream to write to
+     * @param request Request
+     * @return success
+     */
+    static bool writeRequest(QDataStream& stream, Request const& request);
+
+    /**
+     * @brief Deserializes a request
+     * @param stream Stream to read from
+     * @param request Request to populate
+     * @return success
+     */
+    static bool readRequest(QDataStream& stream, Request& request);
+
+    /**
+     * @brief Serializes a response
+     * @param stream Stream to write to
+     * @param response Response
+     * @return success
+     */
+    static bool writeResponse(QDataStream& stream, Response const& response);
+
+    /**
+     * @brief Deserializes a response
+     * @param stream Stream to read from
+     * @param response Response to populate
+     * @return success
+     */
+    static bool readResponse(QDataStream& stream, Response& response);
+
+private:
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+
+    explicit WorkerPool(QObject* parent);
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_WORKERPOOL_H
@@ -0,0 +1,821 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/executionplan.h"
+
+#include "intelli/graph.h"
+#include "intelli/graphuservariables.h"
+#include "intelli/node.h"
+#include "intelli/nodedatafactory.h"
+#include "intelli/nodedatainterface.h"
+#include "intelli/private/utils.h"
+
+#include <gt_algorithms.h>
+#include <gt_coreapplication.h>
+#include <gt_objectfactory.h>
+#include <gt_objectmemento.h>
+#include <gt_project.h>
+#include <gt_qtutilities.h>
+
+#include <QPointer>
+
+using namespace intelli;
+
+struct ExecutionPlan::Impl
+{
+    /// Index denoting that no source or node exists
+    static constexpr size_t NoIndex = std::numeric_limits<size_t>::max();
+
+    /// Input of a node
+    struct Input
+    {
+        /// input port of the node
+        PortId portId;
+        /// index of the output slot the data is read from or `NoIndex`
+        size_t source = NoIndex;
+        /// index of the node the output slot belongs to or `NoIndex`
+        size_t sourceNode = NoIndex;
+        /// type the data is converted to (empty if no conversion is needed)
+        TypeId conversion;
+        /// whether the port is evaluated lazily
+        bool lazy = false;
+        /// whether the port is optional
+        bool optional = true;
+    };
+
+    /// Node of the plan
+    struct Step
+    {
+        /// uuid of the node
+        NodeUuid uuid;
+        /// memento used to instantiate the node
+        GtObjectMemento memento;
+        /// eval mode of the node
+        NodeEvalMode evalMode = NodeEvalMode::Default;
+        /// whether the node has lazy input ports
+        bool hasLazyInputs = false;
+    };
+
+    /// Source of an input port, after resolving all forwarding nodes
+    struct Source
+    {
+        /// node performing the evaluation (null if not connected)
+        Node const* node = nullptr;
+        /// output port of the node
+        PortId portId;
+    };
+
+    /// nodes in topological order
+    std::vector<Step> steps;
+    /// the inputs of the node `i` are `inputs[inputOffsets[i]]` to
+    /// `inputs[inputOffsets[i + 1] - 1]`
+    std::vector<size_t> inputOffsets{0};
+    std::vector<Input> inputs;
+    /// the output slots of the node `i` are `outputOffsets[i]` to
+    /// `outputOffsets[i + 1] - 1`
+    std::vector<size_t> outputOffsets{0};
+    /// output port of each output slot
+    std::vector<PortId> outputs;
+    /// nodes to evaluate
+    std::vector<size_t> targets;
+    /// index of each node
+    QHash<NodeUuid, size_t> indices;
+    /// snapshot of the user variables of the graph
+    std::unique_ptr<GraphUserVariables> userVariables;
+
+    /**
+     * @brief Returns whether the node only forwards data and can be omitted
+     * from the plan, i.e. subgraphs and input and output providers.
+     * @param node Node
+     * @return Is forwarding node
+     */
+    static bool
+    isForwarding(Node const& node)
+    {
+        return qobject_cast<Graph const*>(&node) ||
+               node.nodeEvalMode() == NodeEvalMode::ForwardInputsToOutputs;
+    }
+
+    /// Recursively collects all nodes of the graph hierarchy
+    static void
+    collectNodes(Graph const& graph, QHash<NodeUuid, Node const*>& nodes)
+    {
+        for (Node const* node : graph.nodes())
+        {
+            nodes.insert(node->uuid(), node);
+        }
+        for (Graph const* subgraph : graph.graphNodes())
+        {
+            collectNodes(*subgraph, nodes);
+        }
+    }
+
+    /**
+     * @brief Resolves the source of the input port. Forwarding nodes are
+     * followed until a node is found, that performs an evaluation.
+     * @param conModel Global connection model
+     * @param nodes Nodes of the graph hierarchy
+     * @param nodeUuid Node
+     * @param portId Input port
+     * @return Source. Null if the port is not connected or connected to a node
+     * outside of the graph hierarchy.
+     */
+    static Source
+    resolveSource(GlobalConnectionModel const& conModel,
+                  QHash<NodeUuid, Node const*> const& nodes,
+                  NodeUuid nodeUuid,
+                  PortId portId)
+    {
+        // bounded to avoid an endless loop in case of a malformed model
+        for (int i = 0; i <= nodes.size(); ++i)
+        {
+            Node const* source = nullptr;
+            PortId sourcePort;
+            for (auto const& con : conModel.iterate(nodeUuid, portId))
+            {
+                source = nodes.value(con.node);
+                sourcePort = con.port;
+                break;
+            }
+
+            if (!source) return {};
+            if (!isForwarding(*source)) return { source, sourcePort };
+
+            nodeUuid = source->uuid();
+
+            // subgraphs forward their virtual input ports (see `Graph::eval`)
+            if (qobject_cast<Graph const*>(source))
+            {
+                portId = sourcePort + PortId(2);
+                continue;
+            }
+
+            // outputs are forwarded from the input at the same index
+            PortIndex idx = source->portIndex(PortType::Out, sourcePort);
+            portId = source->portId(PortType::In, idx);
+            if (!portId.isValid()) return {};
+        }
+        return {};
+    }
+
+    /**
+     * @brief Compiles the graph hierarchy into a plan
+     * @param plan Plan to populate
+     * @param graph Graph to compile
+     * @param targets Target nodes. If empty, all nodes are compiled.
+     * @return success
+     */
+    static bool
+    compile(Impl& plan, Graph const& graph, std::vector<NodeUuid> const& targets)
+    {
+        auto const& conModel = graph.globalConnectionModel();
+
+        QHash<NodeUuid, Node const*> nodes;
+        collectNodes(graph, nodes);
+
+        // find all nodes the targets depend on
+        std::vector<Node const*> pending;
+        if (targets.empty())
+        {
+            for (Node const* node : qAsConst(nodes))
+            {
+                if (!isForwarding(*node)) pending.push_back(node);
+            }
+        }
+        for (NodeUuid const& target : targets)
+        {
+            Node const* node = nodes.value(target);
+            if (!node)
+            {
+                gtError() << utils::logId(graph)
+                          << QObject::tr("Failed to compile graph, "
+                                         "target node '%1' not found!")
+                                 .arg(target);
+                return false;
+            }
+            // forwarding nodes are resolved
+            if (!isForwarding(*node)) pending.push_back(node);
+        }
+
+        std::map<NodeUuid, std::vector<Source>> sources;
+        std::map<NodeUuid, std::vector<NodeUuid>> adjacencyMatrix;
+        while (!pending.empty())
+        {
+            Node const* node = pending.back();
+            pending.pop_back();
+
+            if (sources.find(node->uuid()) != sources.end()) continue;
+
+            std::vector<Source>& nodeSources = sources[node->uuid()];
+            adjacencyMatrix[node->uuid()];
+
+            for (auto const& port : node->ports(PortType::In))
+            {
+                Source source =
+                    resolveSource(conModel, nodes, node->uuid(), port.id());
+                nodeSources.push_back(source);
+
+                if (!source.node) continue;
+
+                auto& successors = adjacencyMatrix[source.node->uuid()];
+                if (!utils::contains(successors, node->uuid()))
+                {
+                    successors.push_back(node->uuid());
+                }
+                pending.push_back(source.node);
+            }
+        }
+
+        // sort nodes, such that predecessors are evaluated first
+        std::vector<NodeUuid> order = gt::topo_sort(adjacencyMatrix);
+        if (order.size() != sources.size())
+        {
+            gtError() << utils::logId(graph)
+                      << QObject::tr("Failed to compile graph, "
+                                     "the graph contains cycles!");
+            return false;
+        }
+
+        plan.steps.reserve(order.size());
+        for (NodeUuid const& nodeUuid : order)
+        {
+            Node const* node = nodes.value(nodeUuid);
+            assert(node);
+
+            plan.indices.insert(nodeUuid, plan.steps.size());
+
+            Step step;
+            step.uuid = nodeUuid;
+            step.memento = node->toMemento();
+            step.evalMode = node->nodeEvalMode();
+            plan.steps.push_back(std::move(step));
+
+            for (auto const& port : node->ports(PortType::Out))
+            {
+                plan.outputs.push_back(port.id());
+            }
+            plan.outputOffsets.push_back(plan.outputs.size());
+        }
+
+        auto const& factory = NodeDataFactory::instance();
+
+        for (size_t idx = 0; idx < plan.steps.size(); ++idx)
+        {
+            Step& step = plan.steps[idx];
+            Node const* node = nodes.value(step.uuid);
+
+            auto const& ports = node->ports(PortType::In);
+            auto const& nodeSources = sources[step.uuid];
+            assert(ports.size() == nodeSources.size());
+
+            for (size_t i = 0; i < ports.size(); ++i)
+            {
+                auto const& port = ports[i];
+                Source const& source = nodeSources[i];
+
+                Input input;
+                input.portId = port.id();
+                input.lazy = port.lazy;
+                input.optional = port.optional;
+                step.hasLazyInputs |= port.lazy;
+
+                if (source.node)
+                {
+                    size_t sourceIdx = plan.indices.value(source.node->uuid());
+                    PortIndex portIdx =
+                        source.node->portIndex(PortType::Out, source.portId);
+                    assert(portIdx.isValid());
+
+                    input.sourceNode = sourceIdx;
+                    input.source = plan.outputOffsets[sourceIdx] + portIdx.value();
+
+                    // resolve conversion once
+                    auto* sourcePort = source.node->port(source.portId);
+                    assert(sourcePort);
+                    if (sourcePort->typeId != port.typeId &&
+                        factory.canConvert(sourcePort->typeId, port.typeId))
+                    {
+                        input.conversion = port.typeId;
+                    }
+                }
+
+                plan.inputs.push_back(std::move(input));
+            }
+            plan.inputOffsets.push_back(plan.inputs.size());
+        }
+
+        // evaluate nodes, that are not required by any other node
+        if (targets.empty())
+        {
+            for (size_t idx = 0; idx < plan.steps.size(); ++idx)
+            {
+                auto const& successors = adjacencyMatrix[plan.steps[idx].uuid];
+                if (successors.empty()) plan.targets.push_back(idx);
+            }
+        }
+        for (NodeUuid const& target : targets)
+        {
+            auto iter = plan.indices.find(target);
+            if (iter != plan.indices.end()) plan.targets.push_back(*iter);
+        }
+
+        // snapshot user variables
+        auto const* root = graph.rootGraph();
+        assert(root);
+        if (auto* uv = root->findDirectChild<GraphUserVariables const*>())
+        {
+            plan.userVariables = std::make_unique<GraphUserVariables>();
+            for (QString const& key : uv->keys())
+            {
+                plan.userVariables->setValue(key, uv->value(key));
+            }
+        }
+
+        return true;
+    }
+};
+
+ExecutionPlan::ExecutionPlan() = default;
+ExecutionPlan::~ExecutionPlan() = default;
+
+ExecutionPlan::ExecutionPlan(ExecutionPlan const&) = default;
+ExecutionPlan::ExecutionPlan(ExecutionPlan&&) noexcept = default;
+ExecutionPlan& ExecutionPlan::operator=(ExecutionPlan const&) = default;
+ExecutionPlan& ExecutionPlan::operator=(ExecutionPlan&&) noexcept = default;
+
+ExecutionPlan
+ExecutionPlan::compile(Graph const& graph)
+{
+    return compile(graph, {});
+}
+
+ExecutionPlan
+ExecutionPlan::compile(Graph const& graph, std::vector<NodeUuid> const& targets)
+{
+    auto impl = std::make_shared<Impl>();
+
+    ExecutionPlan plan;
+    if (Impl::compile(*impl, graph, targets)) plan.pimpl = std::move(impl);
+    return plan;
+}
+
+ExecutionPlan
+ExecutionPlan::compileSinks(Graph const& graph)
+{
+    QHash<NodeUuid, Node const*> nodes;
+    Impl::collectNodes(graph, nodes);
+
+    std::vector<NodeUuid> targets;
+    for (Node const* node : qAsConst(nodes))
+    {
+        if (node->nodeFlags() & NodeFlag::Sink) targets.push_back(node->uuid());
+    }
+
+    // graphs without sinks are evaluated entirely
+    return compile(graph, targets);
+}
+
+bool
+ExecutionPlan::isValid() const
+{
+    return pimpl != nullptr;
+}
+
+size_t
+ExecutionPlan::size() const
+{
+    return pimpl ? pimpl->steps.size() : 0;
+}
+
+bool
+ExecutionPlan::contains(NodeUuid const& nodeUuid) const
+{
+    return pimpl && pimpl->indices.contains(nodeUuid);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct PlanExecutor::Impl : public NodeDataInterface
+{
+    using Step  = ExecutionPlan::Impl::Step;
+    using Input = ExecutionPlan::Impl::Input;
+
+    static constexpr size_t NoIndex = ExecutionPlan::Impl::NoIndex;
+
+    /// Evaluation state of a node during a run
+    enum State : uint8_t
+    {
+        /// node was not visited yet
+        Pending = 0,
+        /// predecessors of the non-lazy inputs are being evaluated
+        Scheduled,
+        /// predecessors of the demanded lazy inputs are being evaluated
+        Demanding,
+        /// node was evaluated successfully
+        Evaluated,
+        /// node or one of its predecessors failed
+        Failed
+    };
+
+    explicit Impl(ExecutionPlan _plan) :
+        plan(std::move(_plan))
+    {
+        if (gtApp) scopeObject = gtApp->currentProject();
+
+        if (!plan.isValid()) return;
+
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        nodes.reserve(p.steps.size());
+        for (Step const& step : p.steps)
+        {
+            auto node = gt::unique_qobject_cast<Node>(
+                step.memento.toObject(*gtObjectFactory)
+            );
+            if (!node)
+            {
+                gtError() << QObject::tr("Failed to instantiate node '%1' "
+                                         "of the execution plan!")
+                                 .arg(step.uuid);
+                return;
+            }
+
+            exec::setNodeDataInterface(*node, this);
+            nodes.push_back(std::move(node));
+        }
+
+        outputs.resize(p.outputs.size());
+        inputs.resize(p.inputs.size());
+        states.resize(p.steps.size(), Pending);
+    }
+
+    ExecutionPlan plan;
+    /// instances of the nodes
+    std::vector<std::unique_ptr<Node>> nodes;
+    /// data of each output slot
+    std::vector<NodeDataPtr> outputs;
+    /// data of each input
+    std::vector<NodeDataPtr> inputs;
+    /// state of each node
+    std::vector<State> states;
+    /// node that is currently accessing the data
+    size_t current = NoIndex;
+    /// scope object
+    QPointer<GtObject> scopeObject;
+
+    bool isValid() const
+    {
+        return plan.isValid() && nodes.size() == plan.size();
+    }
+
+    /// Returns the index of the node
+    size_t indexOf(NodeUuid const& nodeUuid) const
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+        if (current != NoIndex && p.steps[current].uuid == nodeUuid)
+        {
+            return current;
+        }
+        return p.indices.value(nodeUuid, NoIndex);
+    }
+
+    /// Returns the data of the port, null if the port was not found
+    NodeDataPtr* findData(size_t idx, PortId portId)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        for (size_t i = p.inputOffsets[idx]; i < p.inputOffsets[idx + 1]; ++i)
+        {
+            if (p.inputs[i].portId == portId) return &inputs[i];
+        }
+        for (size_t i = p.outputOffsets[idx]; i < p.outputOffsets[idx + 1]; ++i)
+        {
+            if (p.outputs[i] == portId) return &outputs[i];
+        }
+        return nullptr;
+    }
+
+    NodeDataPtr const* findData(size_t idx, PortId portId) const
+    {
+        return const_cast<Impl*>(this)->findData(idx, portId);
+    }
+
+    /**
+     * @brief Evaluates the target node and all nodes it depends on
+     * @param target Target node
+     * @return success
+     */
+    bool evaluate(size_t target)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        auto const isSelected = [this](size_t idx, Input const& input){
+            return !input.lazy || demanded(idx, input.portId);
+        };
+
+        std::vector<size_t> stack{target};
+        while (!stack.empty())
+        {
+            size_t idx = stack.back();
+
+            switch (states[idx])
+            {
+            case Evaluated:
+            case Failed:
+                stack.pop_back();
+                break;
+            case Pending:
+                states[idx] = Scheduled;
+                schedule(idx, stack, [](Input const& input){
+                    return !input.lazy;
+                });
+                break;
+            case Scheduled:
+                if (!collectInputs(idx, [](Input const& input){ return !input.lazy; }))
+                {
+                    fail(idx);
+                    stack.pop_back();
+                    break;
+                }
+                if (p.steps[idx].hasLazyInputs)
+                {
+                    states[idx] = Demanding;
+                    updateDemand(idx);
+                    schedule(idx, stack, [&isSelected, idx](Input const& input){
+                        return isSelected(idx, input);
+                    });
+                    break;
+                }
+                evaluateNode(idx);
+                stack.pop_back();
+                break;
+            case Demanding:
+                if (!collectInputs(idx, [&isSelected, idx](Input const& input){
+                        return input.lazy && isSelected(idx, input);
+                    }))
+                {
+                    fail(idx);
+                    stack.pop_back();
+                    break;
+                }
+                evaluateNode(idx);
+                stack.pop_back();
+                break;
+            }
+        }
+
+        return states[target] == Evaluated;
+    }
+
+    /// Pushes the sources of the selected inputs that were not visited yet
+    template <typename Predicate>
+    void schedule(size_t idx, std::vector<size_t>& stack, Predicate isSelected)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        for (size_t i = p.inputOffsets[idx]; i < p.inputOffsets[idx + 1]; ++i)
+        {
+            Input const& input = p.inputs[i];
+            if (input.sourceNode == NoIndex || !isSelected(input)) continue;
+
+            if (states[input.sourceNode] == Pending)
+            {
+                stack.push_back(input.sourceNode);
+            }
+        }
+    }
+
+    /// Copies the data of the selected inputs from their sources
+    template <typename Predicate>
+    bool collectInputs(size_t idx, Predicate isSelected)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        for (size_t i = p.inputOffsets[idx]; i < p.inputOffsets[idx + 1]; ++i)
+        {
+            Input const& input = p.inputs[i];
+            if (!isSelected(input)) continue;
+
+            NodeDataPtr data;
+            if (input.source != NoIndex)
+            {
+                if (states[input.sourceNode] != Evaluated) return false;
+
+                data = outputs[input.source];
+                if (data && !input.conversion.isEmpty() &&
+                    data->typeId() != input.conversion)
+                {
+                    if (auto converted = convert(data, input.conversion))
+                    {
+                        data = std::move(converted);
+                    }
+                }
+            }
+
+            if (!data && !input.optional)
+            {
+                gtWarning() << utils::logId(*nodes[idx])
+                            << QObject::tr("Missing required input data!");
+                return false;
+            }
+
+            inputs[i] = std::move(data);
+        }
+        return true;
+    }
+
+    /// Lazy input ports demanded by each node
+    std::vector<std::vector<PortId>> demandedInputs;
+
+    bool demanded(size_t idx, PortId portId) const
+    {
+        if (idx >= demandedInputs.size()) return false;
+        return utils::contains(demandedInputs[idx], portId);
+    }
+
+    /// Queries the lazy input ports demanded by the node
+    void updateDemand(size_t idx)
+    {
+        if (demandedInputs.size() != nodes.size())
+        {
+            demandedInputs.resize(nodes.size());
+        }
+
+        current = idx;
+        demandedInputs[idx] = nodes[idx]->demandedInputs();
+        current = NoIndex;
+    }
+
+    /// Marks the node as failed and resets its outputs
+    void fail(size_t idx)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        states[idx] = Failed;
+        std::fill(outputs.begin() + p.outputOffsets[idx],
+                  outputs.begin() + p.outputOffsets[idx + 1],
+                  nullptr);
+    }
+
+    /// Evaluates the node, requires that all inputs were collected
+    void evaluateNode(size_t idx)
+    {
+        ExecutionPlan::Impl const& p = *plan.pimpl;
+
+        states[idx] = Evaluated;
+
+        if (p.steps[idx].evalMode != NodeEvalMode::NoEvaluationRequired)
+        {
+            current = idx;
+            exec::silentEvaluation(*nodes[idx], *this);
+            current = NoIndex;
+        }
+
+        if (states[idx] == Failed) fail(idx);
+    }
+
+    NodeDataSet nodeData(NodeUuid const& nodeUuid, PortId portId) const override
+    {
+        size_t idx = indexOf(nodeUuid);
+        if (idx == NoIndex) return {};
+
+        auto* data = findData(idx, portId);
+        return data ? NodeDataSet{*data} : NodeDataSet{};
+    }
+
+    NodeDataPtrList nodeData(NodeUuid const& nodeUuid, PortType type) const override
+    {
+        size_t idx = indexOf(nodeUuid);
+        if (idx == NoIndex) return {};
+
+        NodeDataPtrList data;
+        for (auto const& port : nodes[idx]->ports(type))
+        {
+            auto* d = findData(idx, port.id());
+            data.push_back({port.id(), d ? *d : nullptr});
+        }
+        return data;
+    }
+
+    bool setNodeData(NodeUuid const& nodeUuid, PortId portId, NodeDataSet data) override
+    {
+        size_t idx = indexOf(nodeUuid);
+        if (idx == NoIndex) return false;
+
+        auto* d = findData(idx, portId);
+        if (!d) return false;
+
+        *d = std::move(data.ptr);
+        return true;
+    }
+
+    bool setNodeData(NodeUuid const& nodeUuid, PortType type, NodeDataPtrList const& data) override
+    {
+        return std::all_of(data.begin(), data.end(), [&](auto const& entry){
+            return setNodeData(nodeUuid, entry.first, entry.second);
+        });
+    }
+
+    NodeEvalState nodeEvalState(NodeUuid const& nodeUuid) const override
+    {
+        size_t idx = indexOf(nodeUuid);
+        if (idx == NoIndex) return NodeEvalState::Invalid;
+        if (idx == current) return NodeEvalState::Evaluating;
+
+        switch (states[idx])
+        {
+        case Evaluated:
+            return NodeEvalState::Valid;
+        case Failed:
+            return NodeEvalState::Invalid;
+        default:
+            return NodeEvalState::Outdated;
+        }
+    }
+
+    void setNodeEvaluationFailed(NodeUuid const& nodeUuid) override
+    {
+        size_t idx = indexOf(nodeUuid);
+        if (idx != NoIndex) states[idx] = Failed;
+    }
+
+    GraphUserVariables const* userVariables() const override
+    {
+        return plan.pimpl->userVariables.get();
+    }
+
+    GtObject* scope() override { return scopeObject; }
+};
+
+PlanExecutor::PlanExecutor(ExecutionPlan plan) :
+    pimpl(std::make_unique<Impl>(std::move(plan)))
+{ }
+
+PlanExecutor::~PlanExecutor() = default;
+
+bool
+PlanExecutor::isValid() const
+{
+    return pimpl->isValid();
+}
+
+bool
+PlanExecutor::run()
+{
+    if (!isValid())
+    {
+        gtError() << QObject::tr("Failed to run execution plan, "
+                                 "plan is invalid!");
+        return false;
+    }
+
+    std::fill(pimpl->outputs.begin(), pimpl->outputs.end(), nullptr);
+    std::fill(pimpl->inputs.begin(), pimpl->inputs.end(), nullptr);
+    std::fill(pimpl->states.begin(), pimpl->states.end(), Impl::Pending);
+    pimpl->demandedInputs.clear();
+
+    bool success = true;
+    for (size_t target : pimpl->plan.pimpl->targets)
+    {
+        success &= pimpl->evaluate(target);
+    }
+    return success;
+}
+
+Node*
+PlanExecutor::findNode(NodeUuid const& nodeUuid)
+{
+    if (!isValid()) return nullptr;
+
+    size_t idx = pimpl->indexOf(nodeUuid);
+    return idx != Impl::NoIndex ? pimpl->nodes[idx].get() : nullptr;
+}
+
+NodeDataPtr
+PlanExecutor::nodeData(NodeUuid const& nodeUuid, PortId portId) const
+{
+    if (!isValid()) return nullptr;
+
+    return pimpl->nodeData(nodeUuid, portId).ptr;
+}
+
+bool
+PlanExecutor::isNodeEvaluated(NodeUuid const& nodeUuid) const
+{
+    if (!isValid()) return false;
+
+    size_t idx = pimpl->indexOf(nodeUuid);
+    return idx != Impl::NoIndex && pimpl->states[idx] == Impl::Evaluated;
+}
+
+void
+PlanExecutor::setScope(GtObject* scope)
+{
+    pimpl->scopeObject = scope;
+}
@@ -0,0 +1,200 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_EXECUTIONPLAN_H
+#define GT_INTELLI_EXECUTIONPLAN_H
+
+#include <intelli/exports.h>
+#include <intelli/globals.h>
+
+#include <memory>
+#include <vector>
+
+class GtObject;
+
+namespace intelli
+{
+
+class Graph;
+class Node;
+class PlanExecutor;
+
+/**
+ * @brief The ExecutionPlan class. Immutable snapshot of a graph hierarchy,
+ * that is compiled into a flat directed acyclic graph. Subgraphs, input and
+ * output providers, and other nodes that only forward their inputs are
+ * resolved during compilation, such that only the nodes that actually perform
+ * an evaluation remain. Nodes and ports are referenced by integer indices,
+ * connections are stored as compressed adjacency lists.
+ *
+ * The plan does not reference the graph it was compiled from and may be
+ * shared between multiple executors (see `PlanExecutor`). Changes to the graph
+ * require a recompilation.
+ */
+class ExecutionPlan
+{
+    friend class PlanExecutor;
+
+public:
+
+    /**
+     * @brief Constructs an empty plan
+     */
+    GT_INTELLI_EXPORT ExecutionPlan();
+    GT_INTELLI_EXPORT ~ExecutionPlan();
+
+    GT_INTELLI_EXPORT ExecutionPlan(ExecutionPlan const&);
+    GT_INTELLI_EXPORT ExecutionPlan(ExecutionPlan&&) noexcept;
+    GT_INTELLI_EXPORT ExecutionPlan& operator=(ExecutionPlan const&);
+    GT_INTELLI_EXPORT ExecutionPlan& operator=(ExecutionPlan&&) noexcept;
+
+    /**
+     * @brief Compiles the graph hierarchy into a plan. All nodes of the graph
+     * and its subgraphs are targets of the plan.
+     * @param graph Graph to compile
+     * @return Plan. Invalid if the compilation failed.
+     */
+    GT_INTELLI_EXPORT
+    static ExecutionPlan compile(Graph const& graph);
+
+    /**
+     * @brief Overload that only compiles the target nodes and the nodes they
+     * depend on.
+     * @param graph Graph to compile
+     * @param targets Target nodes. Must be part of the graph hierarchy.
+     * @return Plan. Invalid if the compilation failed.
+     */
+    GT_INTELLI_EXPORT
+    static ExecutionPlan compile(Graph const& graph,
+                                 std::vector<NodeUuid> const& targets);
+
+    /**
+     * @brief Compiles the sinks of the graph hierarchy (see `NodeFlag::Sink`)
+     * and the nodes they depend on. If the graph has no sinks, the entire
+     * graph is compiled.
+     * @param graph Graph to compile
+     * @return Plan. Invalid if the compilation failed.
+     */
+    GT_INTELLI_EXPORT
+    static ExecutionPlan compileSinks(Graph const& graph);
+
+    /**
+     * @brief Returns whether the plan was compiled successfully
+     * @return Is valid
+     */
+    GT_INTELLI_EXPORT
+    bool isValid() const;
+
+    /**
+     * @brief Returns the number of nodes of the plan
+     * @return Number of nodes
+     */
+    GT_INTELLI_EXPORT
+    size_t size() const;
+
+    /**
+     * @brief Returns whether the node is part of the plan
+     * @param nodeUuid Node
+     * @return Contains node
+     */
+    GT_INTELLI_EXPORT
+    bool contains(NodeUuid const& nodeUuid) const;
+
+private:
+
+    struct Impl;
+    std::shared_ptr<Impl const> pimpl;
+};
+
+/**
+ * @brief The PlanExecutor class. Evaluates an execution plan in the current
+ * thread. The executor instantiates the nodes of the plan once, such that the
+ * plan can be evaluated repeatedly. No signals are emitted and no eval states
+ * are tracked during the evaluation, thus the executor is intended for
+ * headless evaluations.
+ *
+ * Lazy input ports are honored, i.e. the predecessors of a lazy input port are
+ * only evaluated if the input is demanded by the node. The evaluation of a
+ * node is skipped if one of the nodes it depends on failed.
+ */
+class PlanExecutor
+{
+public:
+
+    /**
+     * @brief Constructor. Instantiates the nodes of the plan.
+     * @param plan Plan to execute
+     */
+    GT_INTELLI_EXPORT explicit PlanExecutor(ExecutionPlan plan);
+    GT_INTELLI_EXPORT ~PlanExecutor();
+
+    PlanExecutor(PlanExecutor const&) = delete;
+    PlanExecutor& operator=(PlanExecutor const&) = delete;
+
+    /**
+     * @brief Returns whether the plan is valid and all nodes were instantiated
+     * successfully
+     * @return Is valid
+     */
+    GT_INTELLI_EXPORT
+    bool isValid() const;
+
+    /**
+     * @brief Evaluates all targets of the plan. Results of a previous run are
+     * discarded.
+     * @return Whether all targets were evaluated successfully
+     */
+    GT_INTELLI_EXPORT
+    bool run();
+
+    /**
+     * @brief Returns the instance of the node used by this executor. Can be
+     * used to alter the properties of the node between two runs.
+     * @param nodeUuid Node
+     * @return Node (null if the node is not part of the plan)
+     */
+    GT_INTELLI_EXPORT
+    Node* findNode(NodeUuid const& nodeUuid);
+
+    /**
+     * @brief Returns the node data of the output port of the node from the
+     * last run.
+     * @param nodeUuid Node
+     * @param portId Output port
+     * @return Node data (may be null)
+     */
+    GT_INTELLI_EXPORT
+    NodeDataPtr nodeData(NodeUuid const& nodeUuid, PortId portId) const;
+
+    /**
+     * @brief Returns whether the node was evaluated successfully in the last
+     * run.
+     * @param nodeUuid Node
+     * @return Is evaluated
+     */
+    GT_INTELLI_EXPORT
+    bool isNodeEvaluated(NodeUuid const& nodeUuid) const;
+
+    /**
+     * @brief Sets the scope object used for evaluation. By default the scope
+     * object is the current project.
+     * @param scope Scope object
+     */
+    GT_INTELLI_EXPORT
+    void setScope(GtObject* scope);
+
+private:
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_EXECUTIONPLAN_H
@@ -14,34 +14,235 @@
 #include <intelli/private/utils.h>
 
 #include <gt_eventloop.h>
+#include <gt_finally.h>
 
+#include <QThread>
 #include <QTimer>
 
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
 using namespace intelli;
 
 struct ExecFuture::Impl
 {
-    static inline void
+    /// Returns the uuids of all target nodes
+    static inline std::vector<NodeUuid>
+    targets(ExecFuture const& future)
+    {
+        std::vector<NodeUuid> uuids;
+        uuids.reserve(future.m_targets.size());
+        for (TargetNode const& target : future.m_targets)
+        {
+            uuids.push_back(target.uuid);
+        }
+        return uuids;
+    }
+
+    /**
+     * @brief Subscribes the event loop to the completion of the target nodes.
+     * The model only notifies the event loop once a target node has (failed)
+     * evaluation.
+     * @param future Future
+     * @param loop Event loop to notify, may be notified immediately
+     * @return Subscription id
+     */
+    static inline size_t
     setupEventLoop(ExecFuture const& future, GtEventLoop& loop)
     {
         loop.connectFailed(future.m_model.data(), &GraphExecutionModel::internalError);
 
-        // react to node evaluation signals
-        auto const& performUpdate = [&future, &loop](){
-            future.updateTargets();
-            if (future.areNodesEvaluated()) return emit loop.success();
-            if (future.haveNodesFailed()) return emit loop.failed();
+        // loop failed
+        if (future.m_targets.empty())
+        {
+            emit loop.failed();
+            return 0;
+        }
+
+        QPointer<GtEventLoop> ptr = &loop;
+        return future.m_model->subscribe(targets(future), [ptr](bool success){
+            if (!ptr) return;
+            if (success) emit ptr->success();
+            else emit ptr->failed();
+        });
+    }
+
+    /// State shared between a thread waiting for futures and the threads of
+    /// the associated exec models
+    struct WaitState
+    {
+        enum Status
+        {
+            Pending = 0,
+            Succeeded,
+            Failed
         };
 
-        QObject::connect(future.m_model, &GraphExecutionModel::nodeEvaluated,
-                         &loop, performUpdate);
-        QObject::connect(future.m_model, &GraphExecutionModel::nodeEvaluationFailed,
-                         &loop, performUpdate);
+        enum Mode
+        {
+            WaitForAll,
+            WaitForAny
+        };
 
-        // loop failed
-        if (future.m_targets.empty()) return emit loop.failed();
+        explicit WaitState(size_t size, Mode mode_) :
+            status(size, Pending), mode(mode_), subscriptions(size, 0)
+        {}
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        /// status of each future
+        std::vector<Status> status;
+        /// whether to wait for all or any future
+        Mode mode;
+        /// event loop to quit if the waiting thread runs an event loop
+        QPointer<GtEventLoop> loop;
+        /// subscription of each future
+        std::vector<size_t> subscriptions;
+
+        /// Whether the waiting process is finished. Mutex must be locked.
+        bool isFinished() const
+        {
+            if (mode == WaitForAny)
+            {
+                return status.empty() ||
+                       std::any_of(status.begin(), status.end(),
+                                   [](Status s){ return s != Pending; });
+            }
+            return std::all_of(status.begin(), status.end(),
+                               [](Status s){ return s == Succeeded; }) ||
+                   std::any_of(status.begin(), status.end(),
+                               [](Status s){ return s == Failed; });
+        }
+
+        /// Reports the status of a future. May be called from any thread.
+        void report(size_t idx, Status s)
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (status[idx] != Pending) return;
+
+            status[idx] = s;
+            if (!isFinished()) return;
+
+            condition.notify_all();
+
+            if (loop)
+            {
+                GtEventLoop* l = loop;
+                QMetaObject::invokeMethod(l, [l](){
+                    emit l->success();
+                }, Qt::QueuedConnection);
+            }
+        }
+    };
+
+    /**
+     * @brief Waits for the futures. Reports the completion of the futures
+     * directly from the threads of the exec models. Runs an event loop only if
+     * an exec model lives in the current thread, otherwise blocks the
+     * current thread.
+     * @param futures Futures to wait for
+     * @param timeout Timeout to wait until the waiting process is aborted.
+     * @param mode Whether to wait for all or any future
+     * @return Status of each future
+     */
+    static std::vector<WaitState::Status>
+    waitFor(std::vector<ExecFuture> const& futures,
+            milliseconds timeout,
+            WaitState::Mode mode)
+    {
+        auto state = std::make_shared<WaitState>(futures.size(), mode);
+
+        bool isModelInCurrentThread = false;
+        std::vector<QMetaObject::Connection> connections;
+
+        for (size_t idx = 0; idx < futures.size(); ++idx)
+        {
+            ExecFuture const& future = futures[idx];
+            GraphExecutionModel* model = future.m_model;
+            if (!model || future.m_targets.empty())
+            {
+                state->report(idx, WaitState::Failed);
+                continue;
+            }
+
+            isModelInCurrentThread |= model->thread() == QThread::currentThread();
+
+            auto const fail = [state, idx](){
+                state->report(idx, WaitState::Failed);
+            };
+
+            connections.push_back(QObject::connect(
+                model, &GraphExecutionModel::internalError, fail));
+            connections.push_back(QObject::connect(
+                model, &QObject::destroyed, fail));
+
+            // subscribe in the thread of the exec model
+            auto const subscribe = [state, idx, model, uuids = targets(future)](){
+                size_t id = model->subscribe(uuids, [state, idx](bool success){
+                    state->report(idx, success ? WaitState::Succeeded :
+                                                 WaitState::Failed);
+                });
+
+                std::lock_guard<std::mutex> lock{state->mutex};
+                state->subscriptions[idx] = id;
+            };
+            QMetaObject::invokeMethod(model, subscribe, Qt::QueuedConnection);
+        }
+
+        if (isModelInCurrentThread)
+        {
+            // exec model must continue to process events
+            GtEventLoop loop(timeout);
+            bool isFinished = false;
+            {
+                std::lock_guard<std::mutex> lock{state->mutex};
+                state->loop = &loop;
+                isFinished = state->isFinished();
+            }
+            if (!isFinished) loop.exec();
+
+            std::lock_guard<std::mutex> lock{state->mutex};
+            state->loop = nullptr;
+        }
+        else
+        {
+            std::unique_lock<std::mutex> lock{state->mutex};
+            auto const isFinished = [&state](){ return state->isFinished(); };
+            if (timeout == milliseconds::max())
+            {
+                state->condition.wait(lock, isFinished);
+            }
+            else
+            {
+                state->condition.wait_for(lock, timeout, isFinished);
+            }
+        }
+
+        for (auto& connection : connections)
+        {
+            QObject::disconnect(connection);
+        }
 
-        performUpdate();
+        // remove pending subscriptions in the thread of the exec model
+        for (size_t idx = 0; idx < futures.size(); ++idx)
+        {
+            GraphExecutionModel* model = futures[idx].m_model;
+            if (!model) continue;
+
+            auto const unsubscribe = [state, idx, model](){
+                size_t id = 0;
+                {
+                    std::lock_guard<std::mutex> lock{state->mutex};
+                    id = state->subscriptions[idx];
+                }
+                model->unsubscribe(id);
+            };
+            QMetaObject::invokeMethod(model, unsubscribe, Qt::QueuedConnection);
+        }
+
+        std::lock_guard<std::mutex> lock{state->mutex};
+        return state->status;
     }
 
     /// Helper class that invokes the functor member once all target nodes have
@@ -51,6 +252,8 @@ struct ExecFuture::Impl
         ExecFuture future;
         CallbackFunctor functor;
         
+        size_t subscription = 0;
+
         Observer(ExecFuture const& future_,
                  CallbackFunctor functor_) :
             GtEventLoop(0), // event loop wont be executed
@@ -59,6 +262,11 @@ struct ExecFuture::Impl
         {
             setObjectName("__observer");
         }
+
+        ~Observer()
+        {
+            if (future.m_model) future.m_model->unsubscribe(subscription);
+        }
     };
 };
 
@@ -95,22 +303,66 @@ ExecFuture::wait(milliseconds timeout) const
 
     if (haveNodesFailed()) return false; // some nodes failed -> abort
 
+    // Waiting from a different thread
+    // -> Block thread until the exec model reports the completion
+    if (m_model->thread() != QThread::currentThread())
+    {
+        return waitAll({*this}, timeout);
+    }
+
     // Nodes are still running
     // -> Create local event loop here to start recieving updates from exec model
     GtEventLoop loop(timeout);
-    Impl::setupEventLoop(*this, loop);
 
-    // Nodes may have updated in the meantime (might not be necessary/possible?)
-    if (areNodesEvaluated()) return true;
-    if (haveNodesFailed()) return false;
+    // nodes may be evaluated already, i.e. before the loop is executed
+    bool finished = false, success = false;
+    QObject::connect(&loop, &GtEventLoop::success, &loop, [&](){
+        finished = success = true;
+    });
+    QObject::connect(&loop, &GtEventLoop::failed, &loop, [&](){
+        finished = true;
+    });
+
+    size_t subscription = Impl::setupEventLoop(*this, loop);
+    auto finally = gt::finally([this, subscription](){
+        if (m_model) m_model->unsubscribe(subscription);
+    });
+    Q_UNUSED(finally);
 
     // Perform blocking wait
-    GtEventLoop::State state = loop.exec();
+    if (!finished) loop.exec();
 
     // Reset all targets, so that a subsequent `wait()` has to refetch all states
     resetTargets();
 
-    return state == GtEventLoop::Success;
+    return success;
+}
+
+bool
+ExecFuture::waitAll(std::vector<ExecFuture> const& futures, milliseconds timeout)
+{
+    GT_INTELLI_PROFILE();
+
+    auto status = Impl::waitFor(futures, timeout, Impl::WaitState::WaitForAll);
+
+    return std::all_of(status.begin(), status.end(), [](auto s){
+        return s == Impl::WaitState::Succeeded;
+    });
+}
+
+int
+ExecFuture::waitAny(std::vector<ExecFuture> const& futures, milliseconds timeout)
+{
+    GT_INTELLI_PROFILE();
+
+    auto status = Impl::waitFor(futures, timeout, Impl::WaitState::WaitForAny);
+
+    auto iter = std::find_if(status.begin(), status.end(), [](auto s){
+        return s != Impl::WaitState::Pending;
+    });
+    if (iter == status.end()) return -1;
+
+    return (int)std::distance(status.begin(), iter);
 }
 
 NodeDataSet
@@ -186,9 +438,11 @@ ExecFuture::then(CallbackFunctor functor, milliseconds timeout) const
 
     observer->setParent(m_model);
 
-    Impl::setupEventLoop(observer->future, *observer);
+    // observer may be deleted immediately
+    QPointer<Impl::Observer> ptr = observer.release();
 
-    observer.release();
+    size_t subscription = Impl::setupEventLoop(ptr->future, *ptr);
+    if (ptr) ptr->subscription = subscription;
 
     return *this;
 }
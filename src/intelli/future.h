@@ -17,6 +17,7 @@
 
 #include <chrono>
 #include <functional>
+#include <vector>
 
 #include <QPointer>
 
@@ -47,7 +48,9 @@ public:
 
     /**
      * @brief Waits for the evaluation of all target nodes. This is a blocking
-     * call. However, the event loop will continue in the background.
+     * call. However, if called from the thread of the exec model, the event
+     * loop will continue in the background. If called from any other thread,
+     * the thread is blocked until the exec model signals the completion.
      * An optional timeout may be specified, after which the future aborts the
      * waiting process. If a target node fails to evaluate, the waiting process
      * is aborted.
@@ -57,6 +60,36 @@ public:
     GT_INTELLI_EXPORT
     bool wait(milliseconds timeout = milliseconds::max()) const;
 
+    /**
+     * @brief Waits for the evaluation of all target nodes of all futures.
+     * The futures may belong to different exec models. Does not run a nested
+     * event loop if called from a thread other than the threads of the exec
+     * models, instead the calling thread is blocked until the exec models
+     * signal the completion of the futures.
+     * @param futures Futures to wait for
+     * @param timeout Timeout to wait until the waiting process is aborted.
+     * @return Whether all futures succeeded. Returns true if no futures are
+     * passed.
+     */
+    GT_INTELLI_EXPORT
+    static bool waitAll(std::vector<ExecFuture> const& futures,
+                        milliseconds timeout = milliseconds::max());
+
+    /**
+     * @brief Waits until any of the futures finished, i.e. all of its target
+     * nodes have evaluated or one target node has failed. The futures may
+     * belong to different exec models. Does not run a nested event loop if
+     * called from a thread other than the threads of the exec models.
+     * Call `wait` on the returned future to query whether it succeeded.
+     * @param futures Futures to wait for
+     * @param timeout Timeout to wait until the waiting process is aborted.
+     * @return Index of the first future that finished. Returns -1 if the
+     * timeout was reached or if no futures are passed.
+     */
+    GT_INTELLI_EXPORT
+    static int waitAny(std::vector<ExecFuture> const& futures,
+                       milliseconds timeout = milliseconds::max());
+
     /**
      * @brief Waits for the evaluation of the specified node (and only for the
      * specified node, regardless of all other target nodes) and returns the
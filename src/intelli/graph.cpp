@@ -859,11 +859,15 @@ Graph::moveNode(Node& node, Graph& targetGraph, NodeIdPolicy policy)
     // update connection model
     Impl::NodeDeleted(this)(node.id());
 
-    // models need to be reset once moving finished to avoid inconsistent states
-    if (qobject_cast<Graph*>(&node))
+    auto* subgraph = qobject_cast<Graph*>(&node);
+
+    // the nodes of the subgraph remain in the global connection model, thus
+    // they must be removed if the subgraph is moved to a different hierarchy
+    if (subgraph && pimpl->global != targetGraph.pimpl->global)
     {
-        pimpl->resetAfterModification = true;
-        targetGraph.pimpl->resetAfterModification = true;
+        Impl::detachGlobalConnectionModel(
+            *subgraph, std::make_shared<GlobalConnectionModel>()
+        );
     }
 
     node.disconnect(this);
@@ -872,6 +876,8 @@ Graph::moveNode(Node& node, Graph& targetGraph, NodeIdPolicy policy)
 
     if (!targetGraph.appendNode(&node, policy)) return false;
 
+    if (subgraph) Impl::restoreOutputForwarding(*subgraph);
+
     restoreOnFailure.clear();
     return true;
 }
@@ -1193,17 +1199,6 @@ Graph::emitEndModification()
 
     if (pimpl->modificationCount == 0)
     {
-        if (pimpl->resetAfterModification)
-        {
-            // do not trigger this function twice
-            pimpl->modificationCount++;
-            auto cleanup = gt::finally([this](){ pimpl->modificationCount--; });
-            Q_UNUSED(cleanup);
-
-            pimpl->resetAfterModification = false;
-            rootGraph()->resetGlobalConnectionModel();
-        }
-
         emit endModification(QPrivateSignal());
     }
 }
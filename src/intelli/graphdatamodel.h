@@ -41,6 +41,14 @@ struct DataItem
     NodeEvalState state = NodeEvalState::Outdated;
     /// counter of nodes that are running in subgraph nodes
     size_t evaluatingChildNodes = 0;
+    /// whether the inputs of the node have changed since its last evaluation
+    /// started. Nodes that are outdated but whose inputs did not change can
+    /// skip their evaluation.
+    bool inputsModified = true;
+    /// whether the output data of the node was released after all consumers
+    /// were evaluated. The node has to be reevaluated once its data is
+    /// required again.
+    bool dataReleased = false;
 
     /**
      * @brief Returns the ancestors or descendants depending on the port type
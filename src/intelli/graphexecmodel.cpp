@@ -54,6 +54,22 @@ GraphExecutionModel::GraphExecutionModel(Graph& graph) :
         Impl::s_sync.entries.push_back({this});
     }
 
+    pimpl->debounceTimer.setSingleShot(true);
+    pimpl->debounceTimer.setTimerType(Qt::PreciseTimer);
+    connect(&pimpl->debounceTimer, &QTimer::timeout, this, [this](){
+        Impl::autoEvaluateDebouncedNodes(*this);
+    });
+
+    // notify subscribers of futures
+    connect(this, &GraphExecutionModel::nodeEvaluated,
+            this, [this](QString const& nodeUuid){
+        Impl::onNodeEvaluationSignaled(*this, nodeUuid);
+    }, Qt::DirectConnection);
+    connect(this, &GraphExecutionModel::nodeEvaluationFailed,
+            this, [this](QString const& nodeUuid){
+        Impl::onNodeEvaluationSignaled(*this, nodeUuid);
+    }, Qt::DirectConnection);
+
     // trigger evalaution of nodes that are potentially waiting for evaluation
     connect(this, &GraphExecutionModel::wakeup, this, [this](){
         if (pimpl->queuedNodes.empty()) return;
@@ -113,6 +129,10 @@ GraphExecutionModel::~GraphExecutionModel()
 {
     QMutexLocker locker{&Impl::s_sync.mutex};
     Impl::s_sync.entries.removeAt(Impl::s_sync.indexOf(*this));
+    Impl::s_sync.releaseAll(*this);
+
+    locker.unlock();
+    Impl::s_sync.notify(*this);
 }
 
 GraphExecutionModel*
@@ -227,6 +247,7 @@ GraphExecutionModel::beginReset()
     {
         auto& entry = *pimpl->data.find(*iter);
         entry.state = NodeEvalState::Outdated;
+        entry.dataReleased = false;
         for (auto& e : entry.portsIn ) e.data.state = PortDataState::Outdated;
         for (auto& e : entry.portsOut) e.data.state = PortDataState::Outdated;
 
@@ -245,6 +266,8 @@ GraphExecutionModel::endReset()
     pimpl->pendingNodes.clear();
     pimpl->evaluatingNodes.clear();
     pimpl->data.clear();
+    pimpl->debouncedNodes.clear();
+    pimpl->debounceTimer.stop();
 
     Graph& graph = this->graph();
     setupConnections(graph);
@@ -383,6 +406,24 @@ GraphExecutionModel::evaluateNode(NodeUuid const& nodeUuid)
     return Impl::evaluateNode(*this, nodeUuid);
 }
 
+ExecFuture
+GraphExecutionModel::evaluateNodes(std::vector<NodeUuid> const& nodeUuids)
+{
+    return Impl::evaluateNodes(*this, nodeUuids);
+}
+
+ExecFuture
+GraphExecutionModel::evaluateSinks()
+{
+    return evaluateSinks(this->graph());
+}
+
+ExecFuture
+GraphExecutionModel::evaluateSinks(Graph& graph)
+{
+    return Impl::evaluateSinks(*this, graph);
+}
+
 void
 GraphExecutionModel::stopAutoEvaluatingGraph()
 {
@@ -404,10 +445,29 @@ GraphExecutionModel::stopAutoEvaluatingGraph(Graph& graph)
     }
 }
 
+size_t
+GraphExecutionModel::subscribe(std::vector<NodeUuid> targets,
+                               CompletionCallback callback)
+{
+    return Impl::subscribe(*this, std::move(targets), std::move(callback));
+}
+
+void
+GraphExecutionModel::unsubscribe(size_t subscription)
+{
+    Impl::unsubscribe(*this, subscription);
+}
+
 bool
 GraphExecutionModel::invalidateNode(NodeUuid const& nodeUuid)
 {
-    return Impl::invalidateNode(*this, nodeUuid);
+    auto item = Impl::findData(*this, nodeUuid);
+    if (!item) return false;
+
+    // node must be reevaluated regardless of its inputs
+    item->inputsModified = true;
+
+    return Impl::invalidateNode(*this, nodeUuid, item);
 }
 
 NodeDataSet
@@ -441,6 +501,16 @@ GraphExecutionModel::nodeData(NodeUuid const& nodeUuid,
     auto item = Impl::findPortData(*this, nodeUuid, portId, getNodeDataError);
     if (!item) return {};
 
+    // spilled data is read from disk but not restored (see `restoreNodeData`)
+    if (!item->data.ptr && Impl::isNodeDataSpilled(*this, *item.node, portId))
+    {
+        NodeDataSet data = item->data;
+        data.ptr = Impl::loadSpilledData(
+            *this, Impl::sourcePort(*this, *item.node, portId)
+        );
+        return data;
+    }
+
     return item->data;
 }
 
@@ -452,7 +522,7 @@ GraphExecutionModel::nodeData(const NodeUuid& nodeUuid,
     auto item = Impl::findPortData(*this, nodeUuid, type, portIdx, getNodeDataError);
     if (!item) return {};
 
-    return item->data;
+    return nodeData(nodeUuid, item->portId);
 }
 
 NodeDataPtrList
@@ -568,6 +638,221 @@ GraphExecutionModel::setScope(GtObject* scope)
     pimpl->scope = scope;
 }
 
+void
+GraphExecutionModel::setCancelSupersededEvaluations(bool enable)
+{
+    pimpl->cancelSupersededEvaluations = enable;
+}
+
+bool
+GraphExecutionModel::cancelsSupersededEvaluations() const
+{
+    return pimpl->cancelSupersededEvaluations;
+}
+
+void
+GraphExecutionModel::setDebounceInterval(std::chrono::milliseconds interval)
+{
+    pimpl->debounceInterval = std::max(interval, std::chrono::milliseconds{0});
+}
+
+std::chrono::milliseconds
+GraphExecutionModel::debounceInterval() const
+{
+    return pimpl->debounceInterval;
+}
+
+void
+GraphExecutionModel::setNodeDebounceInterval(NodeUuid const& nodeUuid,
+                                             std::chrono::milliseconds interval)
+{
+    pimpl->nodeDebounceIntervals.insert(
+        nodeUuid, std::max(interval, std::chrono::milliseconds{0})
+    );
+}
+
+void
+GraphExecutionModel::resetNodeDebounceInterval(NodeUuid const& nodeUuid)
+{
+    pimpl->nodeDebounceIntervals.remove(nodeUuid);
+}
+
+std::chrono::milliseconds
+GraphExecutionModel::debounceInterval(NodeUuid const& nodeUuid) const
+{
+    return Impl::debounceInterval(*this, nodeUuid);
+}
+
+void
+GraphExecutionModel::setReleaseIntermediateData(bool enable)
+{
+    pimpl->releaseIntermediateData = enable;
+}
+
+bool
+GraphExecutionModel::releasesIntermediateData() const
+{
+    return pimpl->releaseIntermediateData;
+}
+
+void
+GraphExecutionModel::pinNodeData(NodeUuid const& nodeUuid)
+{
+    pimpl->pinnedNodes.insert(nodeUuid);
+}
+
+void
+GraphExecutionModel::unpinNodeData(NodeUuid const& nodeUuid)
+{
+    pimpl->pinnedNodes.erase(nodeUuid);
+}
+
+bool
+GraphExecutionModel::isNodeDataPinned(NodeUuid const& nodeUuid) const
+{
+    return pimpl->pinnedNodes.find(nodeUuid) != pimpl->pinnedNodes.end();
+}
+
+size_t
+GraphExecutionModel::nodeDataCount() const
+{
+    return Impl::countNodeData(*this);
+}
+
+size_t
+GraphExecutionModel::peakNodeDataCount() const
+{
+    return std::max(pimpl->peakNodeDataCount, nodeDataCount());
+}
+
+size_t
+GraphExecutionModel::releasedNodeDataCount() const
+{
+    return pimpl->releasedNodeDataCount;
+}
+
+size_t
+GraphExecutionModel::peakMemoryUsage() const
+{
+    return std::max(pimpl->peakMemoryUsage, memoryUsage());
+}
+
+size_t
+GraphExecutionModel::releasedNodeDataSize() const
+{
+    return pimpl->releasedNodeDataSize;
+}
+
+void
+GraphExecutionModel::resetNodeDataStatistics()
+{
+    pimpl->peakNodeDataCount = nodeDataCount();
+    pimpl->releasedNodeDataCount = 0;
+    pimpl->peakMemoryUsage = memoryUsage();
+    pimpl->releasedNodeDataSize = 0;
+}
+
+void
+GraphExecutionModel::setMemoryBudget(size_t bytes)
+{
+    pimpl->memoryBudget = bytes;
+
+    // accesses are only tracked while a budget is set
+    if (bytes == 0) pimpl->dataAccess.clear();
+
+    Impl::enforceMemoryBudget(*this);
+}
+
+size_t
+GraphExecutionModel::memoryBudget() const
+{
+    return pimpl->memoryBudget;
+}
+
+size_t
+GraphExecutionModel::memoryUsage() const
+{
+    return Impl::memoryUsage(*this);
+}
+
+void
+GraphExecutionModel::setSpillDirectory(QString path)
+{
+    if (pimpl->spillDirectory == path) return;
+
+    // spilled data is stored in the current directory
+    while (!pimpl->spilledData.empty())
+    {
+        Impl::PortKey key = pimpl->spilledData.begin()->first;
+        auto item = Impl::findPortData(*this, key.first, key.second);
+        if (!item || !Impl::restoreNodeData(*this, item))
+        {
+            Impl::discardSpilledData(*this, key);
+        }
+    }
+
+    pimpl->spillDirectory = std::move(path);
+    pimpl->spillDir.reset();
+
+    Impl::enforceMemoryBudget(*this);
+}
+
+bool
+GraphExecutionModel::restoreNodeData(NodeUuid const& nodeUuid, PortId portId)
+{
+    auto item = Impl::findPortData(*this, nodeUuid, portId, getNodeDataError);
+    if (!item) return false;
+
+    Impl::PortKey key = Impl::sourcePort(*this, *item.node, portId);
+
+    if (item->data.ptr)
+    {
+        Impl::touchNodeData(*this, key);
+        return true;
+    }
+
+    if (!Impl::restoreNodeData(*this, item)) return false;
+
+    Impl::enforceMemoryBudget(*this);
+    return true;
+}
+
+QString
+GraphExecutionModel::spillDirectory() const
+{
+    return pimpl->spillDirectory;
+}
+
+void
+GraphExecutionModel::setSpillCompression(bool enable)
+{
+    pimpl->compressSpilledData = enable;
+}
+
+bool
+GraphExecutionModel::compressesSpilledData() const
+{
+    return pimpl->compressSpilledData;
+}
+
+size_t
+GraphExecutionModel::spilledNodeDataCount() const
+{
+    return pimpl->spilledData.size();
+}
+
+void
+GraphExecutionModel::setResultCache(std::shared_ptr<NodeResultCache> cache)
+{
+    pimpl->resultCache = std::move(cache);
+}
+
+std::shared_ptr<NodeResultCache> const&
+GraphExecutionModel::resultCache() const
+{
+    return pimpl->resultCache;
+}
+
 void
 GraphExecutionModel::nodeEvaluationStarted(NodeUuid const& nodeUuid)
 {
@@ -585,6 +870,7 @@ GraphExecutionModel::nodeEvaluationStarted(NodeUuid const& nodeUuid)
     pimpl->evaluatingNodes.push_back(nodeUuid);
 
     item->state = NodeEvalState::Evaluating;
+    item->inputsModified = false;
     emit item.node->nodeEvalStateChanged();
 
     // update counter for running child nodes
@@ -598,6 +884,7 @@ GraphExecutionModel::nodeEvaluationFinished(NodeUuid const& nodeUuid)
     utils::erase(pimpl->evaluatingNodes, nodeUuid);
 
     // update synchronization entity
+    Impl::s_sync.release(*this, nodeUuid);
     Impl::s_sync.update(*this);
 
     onNodeEvaluated(nodeUuid);
@@ -637,6 +924,8 @@ GraphExecutionModel::onNodeEvaluated(NodeUuid const& nodeUuid)
 
     Node* node = item.node;
 
+    QByteArray cacheKey = pimpl->cacheKeys.take(nodeUuid);
+
     INTELLI_LOG_SCOPE(*this)
         << tr("node '%1' (%2) evaluated!")
                .arg(relativeNodePath(*node))
@@ -679,12 +968,40 @@ GraphExecutionModel::onNodeEvaluated(NodeUuid const& nodeUuid)
         {
             if (port.data.state == PortDataState::Outdated)
             {
+                // outputs that were not updated may have been spilled
+                if (!port.data.ptr)
+                {
+                    auto portItem = Impl::findPortData(*this, item, port.portId);
+                    if (portItem) Impl::restoreNodeData(*this, portItem);
+                }
+
                 port.data.state = PortDataState::Valid;
                 Impl::setNodeData(*this, item,port.portId, port.data, flags);
             }
         }
 
         item->state = NodeEvalState::Valid;
+        item->dataReleased = false;
+
+        // results are only cached if they match the inputs used for the key
+        if (!cacheKey.isEmpty() && pimpl->resultCache && !item->inputsModified)
+        {
+            pimpl->resultCache->store(cacheKey, nodeData(nodeUuid, PortType::Out));
+        }
+
+        // data of all ports is held at this point
+        pimpl->peakNodeDataCount =
+            std::max(pimpl->peakNodeDataCount, Impl::countNodeData(*this));
+        pimpl->peakMemoryUsage =
+            std::max(pimpl->peakMemoryUsage, Impl::memoryUsage(*this));
+
+        // the data of the predecessors may no longer be required
+        if (pimpl->releaseIntermediateData)
+        {
+            Impl::releasePredecessorData(*this, nodeUuid);
+        }
+
+        Impl::enforceMemoryBudget(*this);
     }
     emit item.node->nodeEvalStateChanged();
 
@@ -777,6 +1094,8 @@ GraphExecutionModel::onNodeAppended(Node* node)
     connect(node, &Node::triggerNodeEvaluation,
             this, [this, nodeUuid, autoEvaluate](){
         invalidateNode(nodeUuid);
+        if (Impl::isNodeAutoEvaluating(*this, nodeUuid) &&
+            Impl::debounceAutoEvaluation(*this, nodeUuid)) return;
         autoEvaluate(nodeUuid);
     }, Qt::DirectConnection);
 
@@ -818,9 +1137,16 @@ GraphExecutionModel::onNodeDeleted(Graph* graph, NodeId nodeId)
     utils::erase(pimpl->targetNodes, nodeUuid);
     utils::erase(pimpl->queuedNodes, nodeUuid);
     utils::erase(pimpl->autoEvaluatingGraphs, nodeUuid);
+    pimpl->debouncedNodes.erase(nodeUuid);
+    pimpl->nodeDebounceIntervals.remove(nodeUuid);
+    pimpl->pinnedNodes.erase(nodeUuid);
+    pimpl->cacheKeys.remove(nodeUuid);
+    Impl::discardSpilledNodeData(*this, nodeUuid);
+    Impl::notifySubscribers(*this, nodeUuid);
     if (utils::erase(pimpl->evaluatingNodes, nodeUuid))
     {
         // update synchronization entity
+        Impl::s_sync.release(*this, nodeUuid);
         Impl::s_sync.update(*this);
     }
 }
@@ -16,11 +16,15 @@
 
 #include <QPointer>
 
+#include <chrono>
+#include <memory>
+
 namespace intelli
 {
 
 class Graph;
 class Node;
+class NodeResultCache;
 
 /**
  * @brief The GraphExecutionModel class.
@@ -172,6 +176,32 @@ public:
      */
     GT_NO_DISCARD
     ExecFuture evaluateNode(NodeUuid const& nodeUuid);
+    /**
+     * @brief Starts the demand-driven evaluation of the given target nodes.
+     * Only the nodes that the targets depend on are evaluated, any other node
+     * (e.g. dangling branches) is skipped. Use the owning node to target a
+     * specific output port.
+     * @param nodeUuids Target nodes
+     * @return Future object
+     */
+    GT_NO_DISCARD
+    ExecFuture evaluateNodes(std::vector<NodeUuid> const& nodeUuids);
+    /**
+     * @brief Starts the demand-driven evaluation of all sink nodes (see
+     * `NodeFlag::Sink`) of the graph associated with this exec model and its
+     * subgraphs, as well as the graph's output provider. Falls back to
+     * `evaluateGraph` if the graph has no sink nodes.
+     * @return Future object
+     */
+    GT_NO_DISCARD
+    ExecFuture evaluateSinks();
+    /**
+     * @brief Starts the demand-driven evaluation of all sink nodes of the
+     * given graph and its subgraphs (see `evaluateSinks`).
+     * @return Future object
+     */
+    GT_NO_DISCARD
+    ExecFuture evaluateSinks(Graph& graph);
 
     /**
      * @brief Stops the auto evaluation of the graph that is associated with
@@ -297,6 +327,228 @@ public:
      */
     void setScope(GtObject* scope);
 
+    /**
+     * @brief Sets whether running evaluations of auto-evaluating nodes should
+     * be canceled once their inputs change. The node is reevaluated once the
+     * canceled evaluation returns. Only applies to detached evaluations of
+     * nodes that poll `Node::isEvaluationCanceled`. Enabled by default.
+     * @param enable Whether to cancel superseded evaluations
+     */
+    void setCancelSupersededEvaluations(bool enable);
+
+    /**
+     * @brief Returns whether running evaluations of auto-evaluating nodes are
+     * canceled once their inputs change.
+     * @return Whether superseded evaluations are canceled
+     */
+    bool cancelsSupersededEvaluations() const;
+
+    /**
+     * @brief Sets the window in which successive triggers of an
+     * auto-evaluating node (e.g. while dragging a slider) are coalesced. The
+     * node is invalidated immediately, but only scheduled once no further
+     * trigger occured within the window. Thus the latest value wins. A window
+     * of zero disables debouncing (default).
+     * @param interval Debounce window
+     */
+    void setDebounceInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Returns the default debounce window of all nodes.
+     * @return Debounce window
+     */
+    std::chrono::milliseconds debounceInterval() const;
+
+    /**
+     * @brief Overrides the debounce window of a single node. Use a window of
+     * zero to disable debouncing of this node.
+     * @param nodeUuid Node to debounce
+     * @param interval Debounce window
+     */
+    void setNodeDebounceInterval(NodeUuid const& nodeUuid,
+                                 std::chrono::milliseconds interval);
+
+    /**
+     * @brief Resets the debounce window of the node to the default window.
+     * @param nodeUuid Node
+     */
+    void resetNodeDebounceInterval(NodeUuid const& nodeUuid);
+
+    /**
+     * @brief Returns the debounce window of the given node.
+     * @param nodeUuid Node
+     * @return Debounce window
+     */
+    std::chrono::milliseconds debounceInterval(NodeUuid const& nodeUuid) const;
+
+    /**
+     * @brief Sets whether intermediate node data should be released to reduce
+     * the peak memory. The output data of a node is released once all of its
+     * consumers have been evaluated, unless the node is a target node, is auto
+     * evaluated or its data is pinned (see `pinNodeData`). A node, whose data
+     * was released, is reevaluated once its data is required again. Disabled
+     * by default.
+     * @param enable Whether to release intermediate data
+     */
+    void setReleaseIntermediateData(bool enable);
+
+    /**
+     * @brief Returns whether intermediate node data is released once all
+     * consumers have been evaluated.
+     * @return Whether intermediate data is released
+     */
+    bool releasesIntermediateData() const;
+
+    /**
+     * @brief Pins the data of the node, such that it is never released (e.g.
+     * because it is displayed in the UI).
+     * @param nodeUuid Node to pin
+     */
+    void pinNodeData(NodeUuid const& nodeUuid);
+
+    /**
+     * @brief Unpins the data of the node.
+     * @param nodeUuid Node to unpin
+     */
+    void unpinNodeData(NodeUuid const& nodeUuid);
+
+    /**
+     * @brief Returns whether the data of the node is pinned
+     * @param nodeUuid Node
+     * @return Is pinned
+     */
+    bool isNodeDataPinned(NodeUuid const& nodeUuid) const;
+
+    /**
+     * @brief Returns the number of output ports that currently hold data.
+     * @return Number of data objects held by the model
+     */
+    size_t nodeDataCount() const;
+
+    /**
+     * @brief Returns the max. number of output ports that held data at once
+     * since the statistics were last reset. Can be compared to `nodeDataCount`
+     * to estimate the savings of releasing intermediate data.
+     * @return Peak number of data objects held by the model
+     */
+    size_t peakNodeDataCount() const;
+
+    /**
+     * @brief Returns the number of output ports, whose data was released since
+     * the statistics were last reset.
+     * @return Number of released data objects
+     */
+    size_t releasedNodeDataCount() const;
+
+    /**
+     * @brief Returns the max. number of bytes of node data held at once since
+     * the statistics were last reset (see `NodeData::byteSize`). Can be
+     * compared to `memoryUsage` to estimate the savings of releasing
+     * intermediate data.
+     * @return Peak memory usage in bytes
+     */
+    size_t peakMemoryUsage() const;
+
+    /**
+     * @brief Returns the number of bytes of node data, that was released since
+     * the statistics were last reset (see `NodeData::byteSize`).
+     * @return Size of the released data in bytes
+     */
+    size_t releasedNodeDataSize() const;
+
+    /**
+     * @brief Resets the peak and the number and size of released data objects.
+     */
+    void resetNodeDataStatistics();
+
+    /**
+     * @brief Sets the max. number of bytes of node data that should be held
+     * in memory (see `NodeData::byteSize`). Once the budget is exceeded, the
+     * least recently used data is spilled to disk. Spilled inputs are
+     * restored before a node is evaluated, other spilled data can be restored
+     * using `restoreNodeData`. Data of types that do not support
+     * serialization (see `NodeData::serialize`) is never spilled. A budget of
+     * zero disables spilling (default).
+     * @param bytes Memory budget in bytes
+     */
+    void setMemoryBudget(size_t bytes);
+
+    /**
+     * @brief Returns the memory budget.
+     * @return Memory budget in bytes (zero if unlimited)
+     */
+    size_t memoryBudget() const;
+
+    /**
+     * @brief Restores the spilled data of the given port and marks it as
+     * recently used. For input ports the data of the connected output port is
+     * restored. `nodeData` only reads spilled data from disk without restoring
+     * it. If the spilled data cannot be read, the source node is invalidated.
+     * @param nodeUuid Node's uuid
+     * @param portId Input or output port
+     * @return Whether the data of the port is held in memory
+     */
+    bool restoreNodeData(NodeUuid const& nodeUuid, PortId portId);
+
+    /**
+     * @brief Returns the approximate number of bytes of node data that is
+     * currently held in memory.
+     * @return Memory usage in bytes
+     */
+    size_t memoryUsage() const;
+
+    /**
+     * @brief Sets the directory in which spilled data is stored. A temporary
+     * sub directory is created on demand and removed together with the model.
+     * Data that was already spilled is restored. Defaults to the temporary
+     * directory of the system.
+     * @param path Path to the directory
+     */
+    void setSpillDirectory(QString path);
+
+    /**
+     * @brief Returns the directory in which spilled data is stored.
+     * @return Path to the directory (empty if the system's temporary directory
+     * is used)
+     */
+    QString spillDirectory() const;
+
+    /**
+     * @brief Sets whether spilled data should be compressed. Disabled by
+     * default.
+     * @param enable Whether to compress spilled data
+     */
+    void setSpillCompression(bool enable);
+
+    /**
+     * @brief Returns whether spilled data is compressed.
+     * @return Whether spilled data is compressed
+     */
+    bool compressesSpilledData() const;
+
+    /**
+     * @brief Returns the number of output ports, whose data is currently
+     * spilled to disk.
+     * @return Number of spilled data objects
+     */
+    size_t spilledNodeDataCount() const;
+
+    /**
+     * @brief Sets the persistent cache used to store and load the results of
+     * nodes that are flagged as cacheable (see `NodeFlag::Cacheable`). If an
+     * entry exists for the properties and inputs of such a node, its outputs
+     * are loaded from the cache instead of evaluating the node. The cache may
+     * be shared between multiple models. No cache is used by default.
+     * @param cache Result cache (may be null)
+     */
+    void setResultCache(std::shared_ptr<NodeResultCache> cache);
+
+    /**
+     * @brief Returns the persistent result cache.
+     * @return Result cache (may be null)
+     */
+    std::shared_ptr<NodeResultCache> const& resultCache() const;
+
 protected:
 
     /**
@@ -359,10 +611,32 @@ signals:
 
 private:
 
+    friend class ExecFuture;
+
     // helper struct to "hide" implementation details
     struct Impl;
     std::unique_ptr<Impl> pimpl;
 
+    /// Callback invoked once all target nodes have evaluated or a target
+    /// node has failed
+    using CompletionCallback = std::function<void(bool success)>;
+
+    /**
+     * @brief Subscribes to the completion of the target nodes. The callback
+     * is invoked exactly once, either once all target nodes have evaluated or
+     * once a target node has failed. The callback may be invoked immediately.
+     * @param targets Target nodes
+     * @param callback Callback
+     * @return Subscription id
+     */
+    size_t subscribe(std::vector<NodeUuid> targets, CompletionCallback callback);
+
+    /**
+     * @brief Removes the subscription without invoking its callback.
+     * @param subscription Subscription id
+     */
+    void unsubscribe(size_t subscription);
+
     void beginReset();
 
     void endReset();
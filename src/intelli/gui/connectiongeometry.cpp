@@ -98,25 +98,47 @@ ConnectionGeometry::controlPoints(QPointF start, QPointF end, ConnectionShape sh
 }
 
 
+QPainterPath const&
+ConnectionGeometry::path() const
+{
+    if (m_pathDirty) computePath();
+    return m_path;
+}
+
+QPainterPath const&
+ConnectionGeometry::shape() const
+{
+    if (m_shapeDirty) computeShape();
+    return m_shape;
+}
+
 void
 ConnectionGeometry::recomputeGeometry(QPointF start, QPointF end, ConnectionShape shape)
 {
-    computePath(start, end, shape);
+    m_start = start;
+    m_end = end;
+    m_connectionShape = shape;
 
-    computeShape(start, end, shape);
+    // the path and hitbox are expensive to compute and are only required
+    // when painting or hit-testing
+    m_pathDirty = true;
+    m_shapeDirty = true;
 
-    computeBoundingRect(start, end, shape);
+    computeBoundingRect();
 }
 
 void
-ConnectionGeometry::computePath(QPointF start, QPointF end, ConnectionShape shape)
+ConnectionGeometry::computePath() const
 {
-    auto c1c2 = controlPoints(start, end, shape);
+    QPointF const start = m_start;
+    QPointF const end = m_end;
+
+    auto c1c2 = controlPoints(start, end, m_connectionShape);
 
     // cubic spline
     QPainterPath path(start);
 
-    switch (shape)
+    switch (m_connectionShape)
     {
     case ConnectionShape::Cubic:
         path.cubicTo(c1c2.first, c1c2.second, end);
@@ -132,24 +154,29 @@ ConnectionGeometry::computePath(QPointF start, QPointF end, ConnectionShape shap
     }
 
     m_path = path;
+    m_pathDirty = false;
 }
 
 void
-ConnectionGeometry::computeShape(QPointF start, QPointF end, ConnectionShape shape)
+ConnectionGeometry::computeShape() const
 {
     QPainterPathStroker stroker;
     stroker.setWidth(2 * style::currentStyle().node.portRadius);
-    m_shape = stroker.createStroke(m_path);
+    m_shape = stroker.createStroke(path());
+    m_shapeDirty = false;
 }
 
 void
-ConnectionGeometry::computeBoundingRect(QPointF start, QPointF end, ConnectionShape shape)
+ConnectionGeometry::computeBoundingRect()
 {
+    QPointF const start = m_start;
+    QPointF const end = m_end;
+
     // (adapted)
     // SPDX-SnippetBegin
     // SPDX-License-Identifier: LicenseRef-BSD-3-Clause-Dimitri
     // SPDX-SnippetCopyrightText: 2022 Dimitri Pinaev
-    auto points = controlPoints(start, end, shape);
+    auto points = controlPoints(start, end, m_connectionShape);
 
     // `normalized()` fixes inverted rects.
     QRectF basicRect = QRectF{start, end}.normalized();
@@ -30,13 +30,17 @@ public:
 
     /// returns the coarse bounding rect for the current connection shape.
     inline QRectF boundingRect() const { return m_rect; }
-    /// returns the painter path for the current connection shape.
-    inline QPainterPath const& path() const { return m_path; }
-    /// returns the hitbox for the current connection shape.
-    inline QPainterPath const& shape() const { return m_shape; }
+    /// returns the painter path for the current connection shape. The path is
+    /// computed lazily.
+    QPainterPath const& path() const;
+    /// returns the hitbox for the current connection shape. The hitbox is
+    /// computed lazily.
+    QPainterPath const& shape() const;
 
     /**
-     * @brief Tells the geometry to invalidate cached geometry.
+     * @brief Tells the geometry to invalidate cached geometry. Only the
+     * bounding rect is recomputed immediately, the path and hitbox are
+     * recomputed once they are accessed.
      * @param start Start point of connection
      * @param end End point of connection
      * @param shape Shape of the connection
@@ -47,15 +51,21 @@ private:
 
     QRectF m_rect;
     /// Path denoting connection shape
-    QPainterPath m_path;
+    mutable QPainterPath m_path;
     /// Path denoting connection hitbox
-    QPainterPath m_shape;
+    mutable QPainterPath m_shape;
+    /// Start and end point of the connection
+    QPointF m_start, m_end;
+    /// Shape of the connection
+    ConnectionShape m_connectionShape = ConnectionShape::DefaultShape;
+    /// Whether the path and hitbox are outdated
+    mutable bool m_pathDirty = false, m_shapeDirty = false;
 
-    void computePath(QPointF start, QPointF end, ConnectionShape shape);
+    void computePath() const;
 
-    void computeShape(QPointF start, QPointF end, ConnectionShape shape);
+    void computeShape() const;
 
-    void computeBoundingRect(QPointF start, QPointF end, ConnectionShape shape);
+    void computeBoundingRect();
 };
 
 } // namespace intelli
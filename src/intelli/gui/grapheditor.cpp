@@ -11,6 +11,7 @@
 
 #include <intelli/graph.h>
 #include <intelli/graphexecmodel.h>
+#include <intelli/noderesultcache.h>
 #include <intelli/gui/graphscene.h>
 #include <intelli/gui/graphscenemanager.h>
 #include <intelli/gui/graphstatemanager.h>
@@ -88,6 +89,10 @@ GraphEditor::setData(GtObject* obj)
         return;
     }
     model->setScope(gtApp->currentProject());
+    // coalesce rapid changes of input widgets (e.g. dragging a slider)
+    model->setDebounceInterval(std::chrono::milliseconds(50));
+    // results of cacheable nodes are shared across graphs and sessions
+    model->setResultCache(NodeResultCache::defaultCache());
     model->reset();
 
     // setup state manager
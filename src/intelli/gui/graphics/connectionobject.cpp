@@ -81,16 +81,16 @@ ConnectionGraphicsObject::ConnectionGraphicsObject(QGraphicsScene& scene,
         connect(node, &Node::portChanged, this, updatePortType);
         updatePortType(connectionId().port(type));
 
-        // update connection's position if node object changes
-        auto updateEndPoint = [this, nodeObj, type, portId](){
-            QPointF endPoint = calcEndPoint(nodeObj, type, portId);
-            setEndPoint(type, endPoint);
+        // update connection's position if node object changes, updates are
+        // batched to recompute the geometry only once
+        auto updateEndPoint = [this, type](){
+            markEndPointDirty(type);
         };
         connect(nodeObj, &NodeGraphicsObject::xChanged, this, updateEndPoint);
         connect(nodeObj, &NodeGraphicsObject::yChanged, this, updateEndPoint);
         connect(nodeObj, &NodeGraphicsObject::nodeGeometryChanged, this, updateEndPoint);
         connect(nodeObj, &NodeGraphicsObject::opacityChanged, this, [this](){ update(); });
-        updateEndPoint();
+        setEndPoint(type, calcEndPoint(nodeObj, type, portId));
     }
 }
 
@@ -142,12 +142,14 @@ ConnectionGraphicsObject::isDraft() const
 QRectF
 ConnectionGraphicsObject::boundingRect() const
 {
+    flushEndPoints();
     return m_geometry.boundingRect();
 }
 
 QPainterPath
 ConnectionGraphicsObject::shape() const
 {
+    flushEndPoints();
     return m_geometry.shape();
 }
 
@@ -160,6 +162,8 @@ ConnectionGraphicsObject::connectionId() const
 QPointF
 ConnectionGraphicsObject::endPoint(PortType type) const
 {
+    flushEndPoints();
+
     switch (type)
     {
     case PortType::In:
@@ -190,10 +194,55 @@ ConnectionGraphicsObject::setEndPoint(PortType type, QPointF pos)
         throw GTlabException(__FUNCTION__, "invalid port type!");
     }
 
-    m_geometry.recomputeGeometry(m_start, m_end, m_shape);
+    m_geometry.recomputeGeometry(m_start, m_end, effectiveShape());
     update();
 }
 
+void
+ConnectionGraphicsObject::markEndPointDirty(PortType type)
+{
+    // the scene is notified while the old geometry is still valid, thus the
+    // geometry is never stale when queried or painted
+    if (!m_outDirty && !m_inDirty) prepareGeometryChange();
+
+    (type == PortType::In ? m_inDirty : m_outDirty) = true;
+
+    if (m_updatePending) return;
+
+    m_updatePending = true;
+    QMetaObject::invokeMethod(this, [this](){
+        m_updatePending = false;
+        updateEndPoints();
+    }, Qt::QueuedConnection);
+}
+
+void
+ConnectionGraphicsObject::updateEndPoints()
+{
+    bool const outDirty = m_outDirty && m_outNode;
+    bool const inDirty  = m_inDirty  && m_inNode;
+    m_outDirty = false;
+    m_inDirty = false;
+
+    if (!outDirty && !inDirty) return;
+
+    // prepareGeometryChange was called once the end points were marked dirty
+    ConnectionId conId = connectionId();
+    if (outDirty) m_start = calcEndPoint(m_outNode, PortType::Out, conId.outPort);
+    if (inDirty)  m_end   = calcEndPoint(m_inNode,  PortType::In,  conId.inPort);
+
+    m_geometry.recomputeGeometry(m_start, m_end, effectiveShape());
+}
+
+void
+ConnectionGraphicsObject::flushEndPoints() const
+{
+    if (!m_outDirty && !m_inDirty) return;
+
+    // the geometry is logically constant, only its computation is deferred
+    const_cast<ConnectionGraphicsObject*>(this)->updateEndPoints();
+}
+
 void
 ConnectionGraphicsObject::setPortTypeId(PortType type, TypeId typeId)
 {
@@ -209,10 +258,32 @@ ConnectionGraphicsObject::setConnectionShape(ConnectionShape shape)
 
     prepareGeometryChange();
     m_shape = shape;
-    m_geometry.recomputeGeometry(m_start, m_end, m_shape);
+    m_geometry.recomputeGeometry(m_start, m_end, effectiveShape());
     update();
 }
 
+void
+ConnectionGraphicsObject::setLevelOfDetail(LevelOfDetail lod)
+{
+    if (m_lod == lod) return;
+
+    ConnectionShape oldShape = effectiveShape();
+    m_lod = lod;
+
+    if (oldShape != effectiveShape())
+    {
+        prepareGeometryChange();
+        m_geometry.recomputeGeometry(m_start, m_end, effectiveShape());
+    }
+    update();
+}
+
+ConnectionShape
+ConnectionGraphicsObject::effectiveShape() const
+{
+    return m_lod == LevelOfDetail::Minimal ? ConnectionShape::Straight : m_shape;
+}
+
 void
 ConnectionGraphicsObject::makeInactive(bool inactive)
 {
@@ -231,6 +302,10 @@ ConnectionGraphicsObject::paint(QPainter* painter,
 
     bool const isDraft  = this->isDraft();
     bool const isInactive = m_inactive;
+    bool const isMinimal = m_lod == LevelOfDetail::Minimal;
+
+    // straight lines do not benefit from antialiasing when zoomed out
+    if (isMinimal) painter->setRenderHint(QPainter::Antialiasing, false);
 
     PortType const draftType = connectionId().draftType();
     assert(!isDraft == (draftType == PortType::NoType)); // NoType if not draft
@@ -244,6 +319,7 @@ ConnectionGraphicsObject::paint(QPainter* painter,
     auto const& style = style::currentStyle();
     auto const& cstyle = style.connection;
 
+    flushEndPoints();
     auto const path = m_geometry.path();
 
     ConnectionPainter p;
@@ -256,12 +332,13 @@ ConnectionGraphicsObject::paint(QPainter* painter,
         flags
     );
 
-    if (draftType == PortType::In  || m_outNode->opacity() < 1)
+    // end points are omitted when zoomed out
+    if (!isMinimal && (draftType == PortType::In  || m_outNode->opacity() < 1))
     {
         double const portRadius = style.node.portRadius;
         p.drawEndPoint(*painter, path, portRadius, PortType::Out);
     }
-    if (draftType == PortType::Out || m_inNode->opacity() < 1)
+    if (!isMinimal && (draftType == PortType::Out || m_inNode->opacity() < 1))
     {
         double const portRadius = style.node.portRadius;
         p.drawEndPoint(*painter, path, portRadius, PortType::In);
@@ -275,7 +352,7 @@ ConnectionGraphicsObject::paint(QPainter* painter,
     QPointF in  = endPoint(PortType::In);
     QPointF out = endPoint(PortType::Out);
 
-    auto const points = m_geometry.controlPoints(in, out, m_shape);
+    auto const points = m_geometry.controlPoints(in, out, effectiveShape());
 
     painter->setPen(Qt::magenta);
     painter->setBrush(Qt::magenta);
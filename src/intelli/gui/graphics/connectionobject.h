@@ -109,6 +109,13 @@ public:
      */
     void setConnectionShape(ConnectionShape shape);
 
+    /**
+     * @brief Setter for the level of detail. Connections are drawn as
+     * straight lines without end points if the level of detail is minimal.
+     * @param lod Level of detail
+     */
+    void setLevelOfDetail(LevelOfDetail lod);
+
     /**
      * @brief Deemphasizes this object, i.e. to visually highlight other
      * objects.
@@ -153,10 +160,16 @@ private:
     ConnectionGeometry m_geometry;
     /// The shape of the connection
     ConnectionShape m_shape = ConnectionShape::DefaultShape;
+    /// The level of detail used for rendering
+    LevelOfDetail m_lod = LevelOfDetail::DefaultLevelOfDetail;
     /// Start and end point of the connection
     QPointF m_start, m_end;
     /// Whether this object is considered inactive
     bool m_inactive = false;
+    /// Whether the start or end point is outdated
+    bool m_outDirty = false, m_inDirty = false;
+    /// Whether an update of the end points is scheduled
+    bool m_updatePending = false;
 
     /**
      * @brief constructor. In case the connection is a draft connection, either
@@ -175,6 +188,35 @@ private:
                                       NodeGraphicsObject const* outNodeObj = {},
                                       NodeGraphicsObject const* inNodeObj = {});
 
+    /**
+     * @brief Returns the shape that is actually used to render the connection.
+     * Respects the level of detail.
+     * @return Connection shape
+     */
+    ConnectionShape effectiveShape() const;
+
+    /**
+     * @brief Marks the end point as outdated and schedules an update. The
+     * scene is notified of the geometry change immediately, whereas the
+     * geometry is recomputed only once for multiple calls (e.g. when moving a
+     * node diagonally), at the latest when the connection is painted.
+     * @param type Denotes the end point for `PortType::In` or the
+     * start point for `PortType::Out`.
+     */
+    void markEndPointDirty(PortType type);
+
+    /**
+     * @brief Recomputes all outdated end points and the geometry of this
+     * connection. Expects that `prepareGeometryChange` was already called.
+     */
+    void updateEndPoints();
+
+    /**
+     * @brief Recomputes the outdated end points before the geometry is
+     * accessed.
+     */
+    void flushEndPoints() const;
+
     QPointF calcEndPoint(NodeGraphicsObject const* nodeObj,
                          PortType portType,
                          PortId portId);
@@ -11,6 +11,7 @@
 #include <intelli/node.h>
 #include <intelli/gui/nodepainter.h>
 #include <intelli/gui/style.h>
+#include <intelli/gui/uiupdatedispatcher.h>
 
 #include <gt_icons.h>
 
@@ -26,18 +27,10 @@ NodeEvalStateGraphicsObject::NodeEvalStateGraphicsObject(QGraphicsObject& parent
                                                          Node& node) :
     QGraphicsObject(&parent),
     m_node(&node),
-    m_timeLine(1000),
     m_painter(&painter)
 {
     setZValue(style::zValue(style::ZValue::NodeEvalState));
 
-    m_timeLine.setEasingCurve(QEasingCurve::Linear);
-    m_timeLine.setLoopCount(0);
-    m_timeLine.setFrameRange(0, 24);
-
-    connect(&m_timeLine, &QTimeLine::frameChanged,
-            m_node, [=](){ this->update(); });
-
     connect(m_node, &Node::nodeEvalStateChanged,
             this, &NodeEvalStateGraphicsObject::onNodeEvalStateChanged,
             Qt::DirectConnection);
@@ -46,6 +39,15 @@ NodeEvalStateGraphicsObject::NodeEvalStateGraphicsObject(QGraphicsObject& parent
     onNodeEvalStateChanged();
 }
 
+NodeEvalStateGraphicsObject::~NodeEvalStateGraphicsObject()
+{
+    // the dispatcher may have been destroyed together with the application
+    if (auto* dispatcher = UiUpdateDispatcher::instance())
+    {
+        dispatcher->stopAnimation(*this);
+    }
+}
+
 QRectF
 NodeEvalStateGraphicsObject::boundingRect() const
 {
@@ -129,7 +131,9 @@ NodeEvalStateGraphicsObject::onNodeEvalStateChanged()
     assert(m_node);
     m_state = m_node->nodeEvalState();
 
-    m_timeLine.stop();
+    // animation is driven by the shared animation clock
+    auto* dispatcher = UiUpdateDispatcher::instance();
+    if (dispatcher) dispatcher->stopAnimation(*this);
 
     switch (m_state)
     {
@@ -147,7 +151,7 @@ NodeEvalStateGraphicsObject::onNodeEvalStateChanged()
         break;
     case NodeEvalState::Evaluating:
         setToolTip(tr("Node is currently evaluating"));
-        m_timeLine.start();
+        if (dispatcher) dispatcher->startAnimation(*this);
         break;
     }
 
@@ -177,7 +181,10 @@ NodeEvalStateGraphicsObject::paintRunningState(QPainter& painter)
     constexpr qreal angleIncrement = FULL_RADIUS / N;
 
     qreal angle = 0.0;
-    angle += FULL_RADIUS * m_timeLine.currentValue();
+    if (auto* dispatcher = UiUpdateDispatcher::instance())
+    {
+        angle += FULL_RADIUS * dispatcher->animationProgress(1000);
+    }
     for (QPointF& pos : circlePositions)
     {
         qreal x = center.x() + ((rect.width() - radius) * 0.5 * qCos(qDegreesToRadians(angle)) * sizePercentage);
@@ -13,7 +13,6 @@
 #include <intelli/globals.h>
 
 #include <QPointer>
-#include <QTimeLine>
 #include <QGraphicsObject>
 
 namespace intelli
@@ -35,6 +34,7 @@ public:
     NodeEvalStateGraphicsObject(QGraphicsObject& parent,
                                 NodePainter& painter,
                                 Node& node);
+    ~NodeEvalStateGraphicsObject();
 
     /**
      * @brief Bounding rect of this object
@@ -52,8 +52,6 @@ private:
 
     /// Associated node
     QPointer<Node> m_node;
-    /// Timeline for anmation
-    QTimeLine m_timeLine;
     /// Painter used for rendering
     NodePainter* m_painter = nullptr;
     /// Node eval state that is displayed currently
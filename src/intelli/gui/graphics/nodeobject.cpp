@@ -42,6 +42,8 @@ struct NodeGraphicsObject::Impl
     QPointer<Node> node;
     /// Central widget
     QPointer<QGraphicsWidget> centralWidget;
+    /// Drop shadow object
+    QPointer<QGraphicsObject> dropShadow;
     /// ui data
     std::unique_ptr<NodeUIData> uiData;
     /// Geometry
@@ -74,6 +76,24 @@ struct NodeGraphicsObject::Impl
         });
     }
 
+    /// Whether the central widget should be visible. Widgets are hidden if the
+    /// node is collapsed or if the scene is not rendered at full detail
+    static inline bool
+    isCentralWidgetVisible(NodeGraphicsObject const* o)
+    {
+        return !o->isCollapsed() &&
+               o->sceneData().levelOfDetail == LevelOfDetail::Full;
+    }
+
+    /// Whether the drop shadow should be visible. Drop shadows are hidden if
+    /// the node is translucent or if the scene is not rendered at full detail
+    static inline bool
+    isDropShadowVisible(NodeGraphicsObject const* o)
+    {
+        return !(o->opacity() < 1.0) &&
+               o->sceneData().levelOfDetail == LevelOfDetail::Full;
+    }
+
 }; // struct Impl;
 
 NodeGraphicsObject::NodeGraphicsObject(QGraphicsScene& scene,
@@ -119,7 +139,7 @@ NodeGraphicsObject::NodeGraphicsObject(QGraphicsScene& scene,
     }, Qt::DirectConnection);
 
     connect(this, &InteractableGraphicsObject::objectCollapsed, this, [this](){
-        if (auto w = centralWidget()) w->setVisible(!isCollapsed());
+        if (auto w = centralWidget()) w->setVisible(Impl::isCentralWidgetVisible(this));
         Impl::prepareGeometryChange(this).finalize();
     }, Qt::DirectConnection);
 
@@ -148,9 +168,13 @@ NodeGraphicsObject::NodeGraphicsObject(QGraphicsScene& scene,
         }
     );
 
+    pimpl->dropShadow = shadow;
+
     connect(this, &QGraphicsObject::opacityChanged, shadow, [this, shadow](){
-        shadow->setVisible(!(opacity() < 1.0));
+        shadow->setVisible(Impl::isDropShadowVisible(this));
     });
+
+    updateLevelOfDetail();
 }
 
 NodeGraphicsObject::~NodeGraphicsObject() = default;
@@ -331,6 +355,7 @@ NodeGraphicsObject::embedCentralWidget()
         pimpl->centralWidget->installSceneEventFilter(this);
         pimpl->centralWidget->setContentsMargins(0, 0, 0, 0);
         pimpl->centralWidget->setZValue(style::zValue(style::ZValue::NodeWidget));
+        pimpl->centralWidget->setVisible(Impl::isCentralWidgetVisible(this));
 
         emit updateWidgetPalette(QPrivateSignal());
 
@@ -374,6 +399,19 @@ NodeGraphicsObject::embedCentralWidget()
     }
 }
 
+void
+NodeGraphicsObject::updateLevelOfDetail()
+{
+    LevelOfDetail const lod = sceneData().levelOfDetail;
+
+    if (auto w = centralWidget()) w->setVisible(Impl::isCentralWidgetVisible(this));
+    if (auto shadow = pimpl->dropShadow) shadow->setVisible(Impl::isDropShadowVisible(this));
+
+    pimpl->evalStateObject->setVisible(lod != LevelOfDetail::Minimal);
+
+    update();
+}
+
 void
 NodeGraphicsObject::setupContextMenu(QMenu& menu)
 {
@@ -151,6 +151,13 @@ public:
      */
     void embedCentralWidget();
 
+    /**
+     * @brief Updates the visibility of the central widget, the eval state
+     * object and the drop shadow according to the level of detail of the
+     * scene. Should be called once the level of detail of the scene changed.
+     */
+    void updateLevelOfDetail();
+
     /**
      * @brief Appends actions for the context menu
      * @param menu Menu
@@ -30,6 +30,7 @@
 #include <intelli/gui/graphics/popupitem.h>
 #include <intelli/private/utils.h>
 #include <intelli/private/gui_utils.h>
+#include <intelli/private/spatialgrid.h>
 
 #include <gt_application.h>
 #include <gt_command.h>
@@ -58,8 +59,51 @@
 #include <QTreeWidget>
 #include <QHeaderView>
 
+/// number of nodes from which on a scene is virtualized by default
+constexpr size_t s_virtualization_threshold = 500;
+/// max. number of node objects that are instantiated at once
+constexpr size_t s_virtualization_budget = 100;
+/// margin around the visible region in which objects are still instantiated
+/// (relative to the size of the visible region)
+constexpr double s_virtualization_margin = 0.5;
+
 using namespace intelli;
 
+namespace intelli
+{
+
+/// hash of a connection id, used to index connections spatially
+inline uint
+qHash(ConnectionId const& conId, uint seed = 0) noexcept
+{
+    uint hash = seed;
+    for (quint64 value : {(quint64)conId.outNodeId.value(),
+                          (quint64)conId.outPort.value(),
+                          (quint64)conId.inNodeId.value(),
+                          (quint64)conId.inPort.value()})
+    {
+        hash ^= ::qHash(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+} // namespace intelli
+
+struct GraphScene::SpatialIndex
+{
+    /// Scene bounds of the nodes
+    SpatialGrid<NodeId> nodes;
+    /// Scene bounds spanned by the nodes of each connection
+    SpatialGrid<ConnectionId> connections;
+    /// Nodes whose objects are instantiated
+    QSet<NodeId> instantiated;
+    /// Positions of the node and connection entries, rebuilt lazily once
+    /// entries were removed
+    QHash<NodeId, size_t> nodeEntries;
+    QHash<ConnectionId, size_t> connectionEntries;
+    bool entriesOutdated = false;
+};
+
 struct GraphScene::Impl
 {
 
@@ -192,7 +236,7 @@ highlightCompatibleNodes(GraphScene& scene,
     // "deemphasize" all connections
     for (auto& con : scene.m_connections)
     {
-        con.object->makeInactive(true);
+        if (con.object) con.object->makeInactive(true);
     }
 
     // find nodes that can potentially recieve a connection
@@ -221,18 +265,19 @@ highlightCompatibleNodes(GraphScene& scene,
                         std::back_inserter(targets));
 
     // "unhighlight" all dependencies and dependent nodes
+    // (objects may not be instantiated if the scene is virtualized)
     for (NodeId nodeId : qAsConst(dependencies))
     {
         NodeGraphicsObject* target = scene.nodeObject(nodeId);
-        assert(target);
-        target->highlights().setAsIncompatible();
+        assert(target || scene.m_virtualized);
+        if (target) target->highlights().setAsIncompatible();
     }
     // highlight all potential target nodes
     for (NodeId nodeId : qAsConst(targets))
     {
         NodeGraphicsObject* target = scene.nodeObject(nodeId);
-        assert(target);
-        target->highlights().setCompatiblePorts(sourcePort.typeId, invert(type));
+        assert(target || scene.m_virtualized);
+        if (target) target->highlights().setCompatiblePorts(sourcePort.typeId, invert(type));
     }
 
     // override source port
@@ -248,12 +293,11 @@ clearHighlights(GraphScene& scene)
     // clear target nodes
     for (auto& entry : scene.m_nodes)
     {
-        assert(entry.object);
-        entry.object->highlights().clear();
+        if (entry.object) entry.object->highlights().clear();
     }
     for (auto& con : scene.m_connections)
     {
-        con.object->makeInactive(false);
+        if (con.object) con.object->makeInactive(false);
     }
 }
 
@@ -438,6 +482,448 @@ pasteFrom(GraphScene& scene, Graph& dummy)
     return utils::moveObjectsToGraph(dummy, scene.graph());
 }
 
+/**
+ * @brief Returns an approximation of the local bounding rect of a node, that
+ * has not been instantiated yet.
+ * @param node Node
+ * @return Approximated bounding rect
+ */
+static QRectF
+estimatedNodeBounds(Node const& node)
+{
+    constexpr QSize defaultSize{200, 100};
+
+    return QRectF{QPointF{0, 0}, node.size(defaultSize).expandedTo(defaultSize)};
+}
+
+/**
+ * @brief Returns the bounding rect of a node entry in scene coordinates. The
+ * bounding rect is approximated if the object has not been instantiated.
+ * @param entry Node entry
+ * @return Scene bounding rect
+ */
+static QRectF
+sceneBounds(NodeEntry const& entry)
+{
+    if (entry.object) return entry.object->sceneBoundingRect();
+
+    assert(entry.node);
+    return entry.bounds.translated(entry.node->pos());
+}
+
+/**
+ * @brief Appends a node entry without instantiating its graphics object
+ * @param scene Scene object (this)
+ * @param node Node
+ */
+static void
+appendNodeEntry(GraphScene& scene, Node& node)
+{
+    NodeId nodeId = node.id();
+
+    scene.m_nodes.push_back({nodeId, nullptr, &node, estimatedNodeBounds(node)});
+    scene.m_spatialIndex->nodeEntries.insert(nodeId, scene.m_nodes.size() - 1);
+    indexNode(scene, scene.m_nodes.back());
+
+    // nodes may be moved while their objects are not instantiated (e.g. undo)
+    connect(&node, &Node::nodePositionChanged,
+            &scene, [s = &scene, nodeId](){
+        NodeEntry* entry = findNodeEntry(*s, nodeId);
+        if (!entry) return;
+
+        indexNode(*s, *entry);
+        if (s->m_virtualized) scheduleVirtualizationUpdate(*s);
+    });
+}
+
+/**
+ * @brief Rebuilds the positions of the node and connection entries if entries
+ * were removed
+ * @param scene Scene object (this)
+ */
+static void
+updateEntryPositions(GraphScene& scene)
+{
+    auto& index = *scene.m_spatialIndex;
+    if (!index.entriesOutdated) return;
+
+    index.nodeEntries.clear();
+    index.connectionEntries.clear();
+    for (size_t idx = 0; idx < scene.m_nodes.size(); ++idx)
+    {
+        index.nodeEntries.insert(scene.m_nodes[idx].nodeId, idx);
+    }
+    for (size_t idx = 0; idx < scene.m_connections.size(); ++idx)
+    {
+        index.connectionEntries.insert(scene.m_connections[idx].conId, idx);
+    }
+    index.entriesOutdated = false;
+}
+
+/**
+ * @brief Returns the entry of the node
+ * @param scene Scene object (this)
+ * @param nodeId Node id
+ * @return Node entry (null if not found)
+ */
+static NodeEntry*
+findNodeEntry(GraphScene& scene, NodeId nodeId)
+{
+    updateEntryPositions(scene);
+
+    auto iter = scene.m_spatialIndex->nodeEntries.find(nodeId);
+    if (iter == scene.m_spatialIndex->nodeEntries.end()) return nullptr;
+
+    return &scene.m_nodes[*iter];
+}
+
+/**
+ * @brief Returns the entry of the connection
+ * @param scene Scene object (this)
+ * @param conId Connection id
+ * @return Connection entry (null if not found)
+ */
+static ConnectionEntry*
+findConnectionEntry(GraphScene& scene, ConnectionId conId)
+{
+    updateEntryPositions(scene);
+
+    auto iter = scene.m_spatialIndex->connectionEntries.find(conId);
+    if (iter == scene.m_spatialIndex->connectionEntries.end()) return nullptr;
+
+    return &scene.m_connections[*iter];
+}
+
+/**
+ * @brief Updates the scene bounds of the connection in the spatial index. The
+ * bounds are spanned by the bounds of both nodes.
+ * @param scene Scene object (this)
+ * @param conId Connection id
+ */
+static void
+indexConnection(GraphScene& scene, ConnectionId conId)
+{
+    auto& index = *scene.m_spatialIndex;
+
+    // nodes may not be indexed yet while the scene is set up
+    if (!index.nodes.contains(conId.outNodeId) ||
+        !index.nodes.contains(conId.inNodeId)) return;
+
+    index.connections.insert(conId,
+                             index.nodes.rect(conId.outNodeId)
+                                 .united(index.nodes.rect(conId.inNodeId)));
+}
+
+/**
+ * @brief Updates the scene bounds of the node and its connections in the
+ * spatial index
+ * @param scene Scene object (this)
+ * @param entry Node entry
+ */
+static void
+indexNode(GraphScene& scene, NodeEntry const& entry)
+{
+    scene.m_spatialIndex->nodes.insert(entry.nodeId, sceneBounds(entry));
+
+    auto const& conModel = scene.graph().connectionModel();
+    for (ConnectionId conId : conModel.iterateConnections(entry.nodeId))
+    {
+        indexConnection(scene, conId);
+    }
+}
+
+/**
+ * @brief Instantiates the graphics object of the node entry
+ * @param scene Scene object (this)
+ * @param entry Node entry, object must not be instantiated yet
+ */
+static void
+instantiateNodeObject(GraphScene& scene, NodeEntry& entry)
+{
+    static NodeUI defaultUI;
+
+    assert(!entry.object);
+    assert(entry.node);
+    Node* node = entry.node;
+
+    NodeUI* ui = qobject_cast<NodeUI*>(gtApp->defaultObjectUI(node));
+    if (!ui) ui = &defaultUI;
+
+    auto entity = make_unique_qptr<NodeGraphicsObject, DirectDeleter>(
+        scene, *scene.m_sceneData, *node, *ui
+    );
+
+    // connect signals
+    connect(entity, &NodeGraphicsObject::portContextMenuRequested,
+            &scene, &GraphScene::onPortContextMenu);
+    connect(entity, &NodeGraphicsObject::contextMenuRequested,
+            &scene, &GraphScene::onObjectContextMenu);
+
+    connect(entity, &InteractableGraphicsObject::objectShifted,
+            &scene, &GraphScene::beginMoveCommand, Qt::DirectConnection);
+    connect(entity, &InteractableGraphicsObject::objectMoved,
+            &scene, &GraphScene::endMoveCommand, Qt::DirectConnection);
+
+    connect(entity, &NodeGraphicsObject::nodeDoubleClicked,
+            &scene, &GraphScene::onNodeDoubleClicked, Qt::DirectConnection);
+
+    connect(entity, &NodeGraphicsObject::makeDraftConnection,
+            &scene, &GraphScene::onMakeDraftConnection,
+            Qt::DirectConnection);
+
+    auto* ptr = entity.get();
+
+    entry.object = std::move(entity);
+
+    scene.m_spatialIndex->instantiated.insert(entry.nodeId);
+    indexNode(scene, entry);
+
+    emit scene.objectAdded(ptr, QPrivateSignal());
+}
+
+/**
+ * @brief Releases the graphics object of the node entry. The bounds of the
+ * object are kept to locate the node lazily.
+ * @param scene Scene object (this)
+ * @param entry Node entry, object must be instantiated
+ */
+static void
+releaseNodeObject(GraphScene& scene, NodeEntry& entry)
+{
+    assert(entry.object);
+    entry.bounds = entry.object->boundingRect();
+    entry.object.reset();
+
+    scene.m_spatialIndex->instantiated.remove(entry.nodeId);
+    indexNode(scene, entry);
+}
+
+/**
+ * @brief Instantiates the graphics object of the connection entry
+ * @param scene Scene object (this)
+ * @param entry Connection entry, object must not be instantiated yet
+ * @param outNode Object of the start node
+ * @param inNode Object of the end node
+ */
+static void
+instantiateConnectionObject(GraphScene& scene,
+                            ConnectionEntry& entry,
+                            NodeGraphicsObject& outNode,
+                            NodeGraphicsObject& inNode)
+{
+    assert(!entry.object);
+
+    entry.object = convert_to_unique_qptr<DirectDeleter>(
+        ConnectionGraphicsObject::makeConnection(scene, scene.graph(), entry.conId, outNode, inNode)
+    );
+    entry.object->setConnectionShape(scene.m_connectionShape);
+    entry.object->setLevelOfDetail(scene.m_sceneData->levelOfDetail);
+
+    // update in and out node
+    inNode.update();
+    outNode.update();
+}
+
+/**
+ * @brief Returns the ids of all nodes that are linked to a comment. Comments
+ * require the linked node objects to be instantiated.
+ * @param scene Scene object (this)
+ * @return Node ids
+ */
+static QSet<NodeId>
+linkedNodes(GraphScene& scene)
+{
+    QSet<NodeId> nodeIds;
+
+    CommentGroup* commentGroup = GuiData::accessCommentGroup(scene.graph());
+    if (!commentGroup) return nodeIds;
+
+    auto const& comments = commentGroup->comments();
+    for (CommentData const* comment : comments)
+    {
+        size_t n = comment->nNodeConnections();
+        for (size_t idx = 0; idx < n; ++idx)
+        {
+            nodeIds.insert(comment->nodeConnectionAt(idx));
+        }
+    }
+    return nodeIds;
+}
+
+/**
+ * @brief Returns whether the node object can be released, i.e. the user is
+ * not interacting with the object.
+ * @param scene Scene object (this)
+ * @param object Node object
+ * @return Whether the object can be released
+ */
+static bool
+isReleasable(GraphScene& scene, NodeGraphicsObject& object)
+{
+    if (object.isSelected() || object.isHovered()) return false;
+
+    // object is being cut
+    if (object.opacity() < 1.0) return false;
+
+    // object is highlighted while a draft connection is active
+    if (object.highlights().isActive()) return false;
+
+    QGraphicsItem* grabber = scene.mouseGrabberItem();
+    if (grabber && (grabber == &object || object.isAncestorOf(grabber)))
+    {
+        return false;
+    }
+
+    QGraphicsItem* focus = scene.focusItem();
+    if (focus && object.isAncestorOf(focus)) return false;
+
+    return true;
+}
+
+/**
+ * @brief Instantiates all node and connection objects that are within or close
+ * to the visible region of the scene and releases all other objects.
+ * Instantiates only a limited number of objects at once. The remaining objects
+ * are instantiated in subsequent calls. The objects within the region are
+ * located using the spatial index, such that only the objects close to the
+ * region and the instantiated objects are visited.
+ * @param scene Scene object (this)
+ */
+static void
+updateVirtualization(GraphScene& scene)
+{
+    scene.m_virtualizationPending = false;
+
+    QRectF const& visible = scene.m_visibleRect;
+    if (!scene.m_virtualized || !visible.isValid()) return;
+
+    double const dx = visible.width()  * s_virtualization_margin;
+    double const dy = visible.height() * s_virtualization_margin;
+    QRectF const region = visible.adjusted(-dx, -dy, dx, dy);
+
+    auto& index = *scene.m_spatialIndex;
+    auto const& conModel = scene.graph().connectionModel();
+
+    // find nodes that are visible or that must be instantiated
+    QSet<NodeId> required = linkedNodes(scene);
+    required.unite(index.nodes.find(region));
+
+    // instantiated objects are located exactly, as their geometry may change
+    for (NodeId nodeId : qAsConst(index.instantiated))
+    {
+        NodeEntry* entry = findNodeEntry(scene, nodeId);
+        if (!entry || !entry->object) continue;
+
+        if (!isReleasable(scene, *entry->object) ||
+            entry->object->sceneBoundingRect().intersects(region))
+        {
+            required.insert(nodeId);
+        }
+    }
+
+    // connections are visible if the region spanned by their nodes is visible
+    for (ConnectionId conId : index.connections.find(region))
+    {
+        required.insert(conId.outNodeId);
+        required.insert(conId.inNodeId);
+    }
+
+    // release connections first, as they reference their node objects
+    QVector<NodeId> released;
+    for (NodeId nodeId : qAsConst(index.instantiated))
+    {
+        if (!required.contains(nodeId)) released.push_back(nodeId);
+    }
+    for (NodeId nodeId : qAsConst(released))
+    {
+        for (ConnectionId conId : conModel.iterateConnections(nodeId))
+        {
+            if (ConnectionEntry* con = findConnectionEntry(scene, conId))
+            {
+                con->object.reset();
+            }
+        }
+        if (NodeEntry* entry = findNodeEntry(scene, nodeId))
+        {
+            releaseNodeObject(scene, *entry);
+        }
+    }
+
+    size_t budget = s_virtualization_budget;
+    bool incomplete = false;
+
+    for (NodeId nodeId : qAsConst(required))
+    {
+        if (index.instantiated.contains(nodeId)) continue;
+
+        NodeEntry* entry = findNodeEntry(scene, nodeId);
+        if (!entry || !entry->node) continue;
+
+        if (budget == 0)
+        {
+            incomplete = true;
+            break;
+        }
+        instantiateNodeObject(scene, *entry);
+        --budget;
+
+        // instantiate connections to nodes that are already instantiated
+        for (ConnectionId conId : conModel.iterateConnections(nodeId))
+        {
+            ConnectionEntry* con = findConnectionEntry(scene, conId);
+            if (!con || con->object) continue;
+
+            NodeEntry* outEntry = findNodeEntry(scene, conId.outNodeId);
+            NodeEntry* inEntry  = findNodeEntry(scene, conId.inNodeId);
+            if (!outEntry || !outEntry->object || !inEntry || !inEntry->object) continue;
+
+            instantiateConnectionObject(scene, *con, *outEntry->object, *inEntry->object);
+        }
+    }
+
+    // instantiate remaining objects later
+    if (incomplete) scheduleVirtualizationUpdate(scene);
+}
+
+/**
+ * @brief Schedules an update of the instantiated objects. Multiple calls are
+ * collapsed into a single update.
+ * @param scene Scene object (this)
+ */
+static void
+scheduleVirtualizationUpdate(GraphScene& scene)
+{
+    if (scene.m_virtualizationPending) return;
+
+    scene.m_virtualizationPending = true;
+    QTimer::singleShot(0, &scene, [s = &scene](){
+        updateVirtualization(*s);
+    });
+}
+
+/**
+ * @brief Instantiates all node and connection objects
+ * @param scene Scene object (this)
+ */
+static void
+instantiateAllObjects(GraphScene& scene)
+{
+    for (auto& entry : scene.m_nodes)
+    {
+        if (!entry.object) instantiateNodeObject(scene, entry);
+    }
+    for (auto& con : scene.m_connections)
+    {
+        if (con.object) continue;
+
+        auto* outNode = scene.nodeObject(con.conId.outNodeId);
+        auto* inNode  = scene.nodeObject(con.conId.inNodeId);
+        if (!outNode || !inNode) continue;
+
+        instantiateConnectionObject(scene, con, *outNode, *inNode);
+    }
+}
+
 /// Helper opject to encompass all data necessary for cutting objects seamlessly.
 struct CutOperation
 {
@@ -541,13 +1027,19 @@ struct CutOperation
 
 GraphScene::GraphScene(Graph& graph) :
     m_graph(&graph),
-    m_sceneData(std::make_unique<GraphSceneData>())
+    m_sceneData(std::make_unique<GraphSceneData>()),
+    m_spatialIndex(std::make_unique<SpatialIndex>())
 {
-    // instantiate objects
     auto const& nodes = m_graph->nodes();
+
+    // large graphs are instantiated lazily
+    m_virtualized = (size_t)nodes.size() >= s_virtualization_threshold;
+
+    // instantiate objects
     for (auto* node : nodes)
     {
-        onNodeAppended(node);
+        if (m_virtualized) Impl::appendNodeEntry(*this, *node);
+        else onNodeAppended(node);
     }
     auto const& connections = m_graph->connectionModel().iterateConnections();
     for (ConnectionId conId : connections)
@@ -559,6 +1051,19 @@ GraphScene::GraphScene(Graph& graph) :
     CommentGroup* commentGroup = GuiData::accessCommentGroup(*m_graph);
     if (commentGroup)
     {
+        // nodes linked to comments must always be instantiated
+        if (m_virtualized)
+        {
+            auto const& linked = Impl::linkedNodes(*this);
+            for (auto& entry : m_nodes)
+            {
+                if (!entry.object && linked.contains(entry.nodeId))
+                {
+                    Impl::instantiateNodeObject(*this, entry);
+                }
+            }
+        }
+
         auto const& comments = commentGroup->comments();
         for (auto* comment : comments)
         {
@@ -587,6 +1092,7 @@ GraphScene::GraphScene(Graph& graph) :
         m_comments.clear();
         m_connections.clear();
         m_nodes.clear();
+        m_spatialIndex = std::make_unique<SpatialIndex>();
     });
     connect(m_graph, &Graph::graphAboutToBeDeleted,
             this, &QObject::deleteLater);
@@ -642,7 +1148,7 @@ GraphScene::setConnectionShape(ConnectionShape shape)
     m_connectionShape = shape;
     for (auto& con : m_connections)
     {
-        con.object->setConnectionShape(shape);
+        if (con.object) con.object->setConnectionShape(shape);
     }
     emit connectionShapeChanged();
 }
@@ -653,6 +1159,69 @@ GraphScene::connectionShape() const
     return m_connectionShape;
 }
 
+void
+GraphScene::setLevelOfDetail(LevelOfDetail lod)
+{
+    if (lod == m_sceneData->levelOfDetail) return;
+
+    m_sceneData->levelOfDetail = lod;
+    for (auto& entry : m_nodes)
+    {
+        if (entry.object) entry.object->updateLevelOfDetail();
+    }
+    for (auto& con : m_connections)
+    {
+        if (con.object) con.object->setLevelOfDetail(lod);
+    }
+    emit levelOfDetailChanged();
+}
+
+LevelOfDetail
+GraphScene::levelOfDetail() const
+{
+    return m_sceneData->levelOfDetail;
+}
+
+void
+GraphScene::setVirtualizationEnabled(bool enable)
+{
+    if (m_virtualized == enable) return;
+
+    m_virtualized = enable;
+
+    if (!m_virtualized) return Impl::instantiateAllObjects(*this);
+
+    Impl::scheduleVirtualizationUpdate(*this);
+}
+
+bool
+GraphScene::isVirtualizationEnabled() const
+{
+    return m_virtualized;
+}
+
+void
+GraphScene::setVisibleRect(QRectF const& rect)
+{
+    if (m_visibleRect == rect) return;
+
+    m_visibleRect = rect;
+
+    if (m_virtualized) Impl::scheduleVirtualizationUpdate(*this);
+}
+
+QRectF
+GraphScene::objectsBoundingRect() const
+{
+    QRectF rect = itemsBoundingRect();
+
+    for (auto const& entry : m_nodes)
+    {
+        if (!entry.object && entry.node) rect |= Impl::sceneBounds(entry);
+    }
+    return rect;
+}
+
 NodeGraphicsObject*
 GraphScene::nodeObject(NodeId nodeId)
 {
@@ -839,15 +1408,27 @@ void
 GraphScene::alignObjectsToGrid()
 {
     auto items = this->selectedItems();
-    if (items.empty())
+    bool const alignAll = items.empty();
+    if (alignAll)
     {
         items = this->items();
-        if (items.empty()) return;
+        if (items.empty() && m_nodes.empty()) return;
     }
 
     auto cmd = gtApp->makeCommand(m_graph, tr("Align selection to grid"));
     Q_UNUSED(cmd);
 
+    // align nodes that have not been instantiated
+    if (alignAll)
+    {
+        for (auto& entry : m_nodes)
+        {
+            if (entry.object || !entry.node) continue;
+
+            entry.node->setPos(utils::quantize(entry.node->pos(), m_sceneData->gridSize));
+        }
+    }
+
     for (QGraphicsItem* item : qAsConst(items))
     {
         if (auto* object = graphics_cast<InteractableGraphicsObject*>(item))
@@ -1008,6 +1589,9 @@ GraphScene::pasteObjects()
 void
 GraphScene::selectAll()
 {
+    // selection requires all objects to be instantiated
+    if (m_virtualized) Impl::instantiateAllObjects(*this);
+
     auto const& objects = Impl::findItems<GraphicsObject*>(*this);
     for (GraphicsObject* object : objects)
     {
@@ -1320,40 +1904,12 @@ GraphScene::endMoveCommand(InteractableGraphicsObject* sender)
 void
 GraphScene::onNodeAppended(Node* node)
 {
-    static NodeUI defaultUI;
     assert(node);
 
-    NodeUI* ui = qobject_cast<NodeUI*>(gtApp->defaultObjectUI(node));
-    if (!ui) ui = &defaultUI;
-
-    auto entity = make_unique_qptr<NodeGraphicsObject, DirectDeleter>(
-        *this, *m_sceneData, *node, *ui
-    );
-
-    // connect signals
-    connect(entity, &NodeGraphicsObject::portContextMenuRequested,
-            this, &GraphScene::onPortContextMenu);
-    connect(entity, &NodeGraphicsObject::contextMenuRequested,
-            this, &GraphScene::onObjectContextMenu);
-
-    connect(entity, &InteractableGraphicsObject::objectShifted,
-            this, &GraphScene::beginMoveCommand, Qt::DirectConnection);
-    connect(entity, &InteractableGraphicsObject::objectMoved,
-            this, &GraphScene::endMoveCommand, Qt::DirectConnection);
-
-    connect(entity, &NodeGraphicsObject::nodeDoubleClicked,
-            this, &GraphScene::onNodeDoubleClicked, Qt::DirectConnection);
-
-    connect(entity, &NodeGraphicsObject::makeDraftConnection,
-            this, &GraphScene::onMakeDraftConnection,
-            Qt::DirectConnection);
-
-    auto* ptr = entity.get();
+    Impl::appendNodeEntry(*this, *node);
+    Impl::instantiateNodeObject(*this, m_nodes.back());
 
-    // append to map
-    m_nodes.push_back({node->id(), std::move(entity)});
-
-    emit objectAdded(ptr, QPrivateSignal());
+    if (m_virtualized) Impl::scheduleVirtualizationUpdate(*this);
 }
 
 void
@@ -1364,6 +1920,10 @@ GraphScene::onNodeDeleted(NodeId nodeId)
     if (iter != m_nodes.end())
     {
         m_nodes.erase(iter);
+
+        m_spatialIndex->nodes.remove(nodeId);
+        m_spatialIndex->instantiated.remove(nodeId);
+        m_spatialIndex->entriesOutdated = true;
     }
 }
 void
@@ -1378,6 +1938,7 @@ GraphScene::onNodeDoubleClicked(NodeGraphicsObject* sender)
     if (!graph)
     {
         Impl::CutOperation::instance().clear();
+        if (NodeUI::toMapNode(&node)) return NodeUI::openMapBody(&node);
         return gt::gui::handleObjectDoubleClick(node);
     }
 
@@ -1389,24 +1950,22 @@ GraphScene::onConnectionAppended(ConnectionId conId)
 {
     assert(conId.isValid());
 
+    // append to map
+    m_connections.push_back({conId, nullptr});
+    m_spatialIndex->connectionEntries.insert(conId, m_connections.size() - 1);
+    Impl::indexConnection(*this, conId);
+
     // access nodes and ports
     auto* inNode  = nodeObject(conId.inNodeId);
-    assert(inNode);
-
     auto* outNode = nodeObject(conId.outNodeId);
-    assert(outNode);
 
-    auto entity = convert_to_unique_qptr<DirectDeleter>(
-        ConnectionGraphicsObject::makeConnection(*this, graph(), conId, *outNode, *inNode)
-    );
-    entity->setConnectionShape(m_connectionShape);
+    // object is instantiated lazily once both nodes are instantiated
+    if (m_virtualized && (!inNode || !outNode)) return;
 
-    // append to map
-    m_connections.push_back({conId, std::move(entity)});
+    assert(inNode);
+    assert(outNode);
 
-    // update in and out node
-    inNode->update();
-    outNode->update();
+    Impl::instantiateConnectionObject(*this, m_connections.back(), *outNode, *inNode);
 }
 
 void
@@ -1424,14 +1983,17 @@ GraphScene::onConnectionDeleted(ConnectionId conId)
 
     m_connections.erase(iter);
 
+    m_spatialIndex->connections.remove(conId);
+    m_spatialIndex->entriesOutdated = true;
+
     // update in and out node
     auto* inNode  = nodeObject(conId.inNodeId);
-    assert(inNode);
-    inNode->update();
+    assert(inNode || m_virtualized);
+    if (inNode) inNode->update();
 
     auto* outNode = nodeObject(conId.outNodeId);
-    assert(outNode);
-    outNode->update();
+    assert(outNode || m_virtualized);
+    if (outNode) outNode->update();
 }
 
 void
@@ -74,9 +74,61 @@ public:
 
     ConnectionShape connectionShape() const;
 
+    /**
+     * @brief Sets the level of detail used to render nodes and connections.
+     * Usually set by the view depending on the current zoom.
+     * @param lod Level of detail
+     */
+    void setLevelOfDetail(LevelOfDetail lod);
+
+    /// Returns the level of detail used to render nodes and connections
+    LevelOfDetail levelOfDetail() const;
+
+    /**
+     * @brief Enables or disables the virtualization of this scene. If enabled,
+     * graphics objects are only instantiated for nodes and connections that
+     * are within or close to the visible region of the scene
+     * (see `setVisibleRect`). Objects far outside of the visible region are
+     * released again. Virtualization is enabled by default for large graphs.
+     * @param enable Whether to enable virtualization
+     */
+    void setVirtualizationEnabled(bool enable = true);
+
+    /// Returns whether the scene is virtualized
+    bool isVirtualizationEnabled() const;
+
+    /**
+     * @brief Sets the region of the scene that is currently visible to the
+     * user. Is used to determine which objects should be instantiated if the
+     * scene is virtualized. Usually set by the view.
+     * @param rect Visible region in scene coordinates
+     */
+    void setVisibleRect(QRectF const& rect);
+
+    /**
+     * @brief Returns the bounding rect of all objects in this scene,
+     * including nodes that have not been instantiated yet.
+     * @return Bounding rect in scene coordinates
+     */
+    QRectF objectsBoundingRect() const;
+
+    /**
+     * @brief Returns the graphics object of the given node. May be null
+     * if the node does not exist or if the scene is virtualized and the node
+     * has not been instantiated.
+     * @param nodeId Node id
+     * @return Node object (may be null)
+     */
     NodeGraphicsObject* nodeObject(NodeId nodeId);
     NodeGraphicsObject const* nodeObject(NodeId nodeId) const;
 
+    /**
+     * @brief Returns the graphics object of the given connection. May be null
+     * if the connection does not exist or if the scene is virtualized and the
+     * connection has not been instantiated.
+     * @param conId Connection id
+     * @return Connection object (may be null)
+     */
     ConnectionGraphicsObject* connectionObject(ConnectionId conId);
     ConnectionGraphicsObject const* connectionObject(ConnectionId conId) const;
 
@@ -141,6 +193,8 @@ signals:
 
     void connectionShapeChanged();
 
+    void levelOfDetailChanged();
+
     void snapToGridChanged();
 
     void objectAdded(InteractableGraphicsObject* object, QPrivateSignal);
@@ -155,11 +209,17 @@ protected:
 private:
 
     struct Impl;
+    struct SpatialIndex;
 
     struct NodeEntry
     {
         NodeId nodeId;
+        /// Graphics object, may be null if the scene is virtualized
         unique_qptr<NodeGraphicsObject, DirectDeleter> object;
+        /// Associated node, used to instantiate the object lazily
+        QPointer<Node> node;
+        /// (Approximated) local bounding rect of the object
+        QRectF bounds;
     };
 
     struct ConnectionEntry
@@ -184,10 +244,19 @@ private:
     std::vector<CommentEntry> m_comments;
     /// Shared scene data
     std::unique_ptr<GraphSceneData> m_sceneData;
+    /// Spatial index of the nodes and connections, used to locate the objects
+    /// close to the visible region if the scene is virtualized
+    std::unique_ptr<SpatialIndex> m_spatialIndex;
     /// Shape style of the connections in this scene
     ConnectionShape m_connectionShape = ConnectionShape::DefaultShape;
     /// Currently active command when moving objects
     GtCommand m_objectMoveCmd = {};
+    /// Region of the scene that is visible to the user
+    QRectF m_visibleRect;
+    /// Whether only objects close to the visible region are instantiated
+    bool m_virtualized = false;
+    /// Whether an update of the instantiated objects is scheduled
+    bool m_virtualizationPending = false;
 
     /**
      * @brief Groups the selected objects by moving them into a subgraph.
@@ -10,6 +10,8 @@
 #ifndef GT_INTELLI_GRAPHSCENEDATA_H
 #define GT_INTELLI_GRAPHSCENEDATA_H
 
+#include <intelli/gui/style.h>
+
 namespace intelli
 {
 
@@ -25,6 +27,8 @@ struct GraphSceneData
     int gridSize = 0;
     /// whether nodes should be snaped to the grid when moving
     bool snapToGrid = true;
+    /// level of detail used to render the objects of the scene
+    LevelOfDetail levelOfDetail = LevelOfDetail::DefaultLevelOfDetail;
 };
 
 } // namespace intelli
@@ -174,7 +174,15 @@ GraphStateManager::setupLocalStates(GraphScene* scene)
     QObject::connect(localStates, &LocalStateContainer::nodeCollapsedChanged,
                      scene, onStateChanged);
 
-    connect(&graph, &Graph::nodeAppended, this, onNodeAppended);
+    // node objects may be (re-)instantiated lazily by the scene
+    auto onObjectAdded = [=](InteractableGraphicsObject* object){
+        if (auto* nodeObject = graphics_cast<NodeGraphicsObject*>(object))
+        {
+            onNodeAppended(&nodeObject->node());
+        }
+    };
+
+    connect(scene, &GraphScene::objectAdded, this, onObjectAdded);
 
     // register existing nodes
     for (NodeId nodeId : graph.connectionModel().iterateNodeIds())
@@ -56,6 +56,26 @@ static InteractableGraphicsObject* locateObject(QPointF scenePoint,
     return nullptr;
 }
 
+/// updates the level of detail of the current scene according to the scale
+static void updateLevelOfDetail(GraphView& view)
+{
+    if (auto* scene = view.nodeScene())
+    {
+        scene->setLevelOfDetail(style::levelOfDetail(view.scale()));
+    }
+}
+
+/// updates the visible region of the current scene, used to instantiate only
+/// objects that are (almost) visible
+static void updateVisibleRect(GraphView& view)
+{
+    if (auto* scene = view.nodeScene())
+    {
+        QRect viewRect = view.viewport()->rect();
+        scene->setVisibleRect(view.mapToScene(viewRect).boundingRect());
+    }
+}
+
 }; // Impl
 
 GraphView::GraphView(QWidget* parent) :
@@ -75,6 +95,12 @@ GraphView::GraphView(QWidget* parent) :
     // disable scale range
     setScaleRange(0, 0);
 
+    // reduce rendering details when zooming out
+    connect(this, &GraphView::scaleChanged, this, [this](){
+        Impl::updateLevelOfDetail(*this);
+        Impl::updateVisibleRect(*this);
+    });
+
     // Sets the scene rect to its maximum possible ranges to avoid auto scene range
     // re-calculation when expanding the all QGraphicsItems common rect.
     constexpr int maxSize = 32767;
@@ -172,6 +198,8 @@ GraphView::setScene(GraphScene& scene)
     setScale(1.0);
 
     scene.setGridSize(minorGridSize());
+    Impl::updateLevelOfDetail(*this);
+    Impl::updateVisibleRect(*this);
 
     emit sceneChanged(&scene);
 }
@@ -327,25 +355,39 @@ GraphView::printToPDF()
         return;
     }
 
+    // always print at full detail
+    auto* graphScene = nodeScene();
+    LevelOfDetail lod = LevelOfDetail::DefaultLevelOfDetail;
+    if (graphScene)
+    {
+        lod = graphScene->levelOfDetail();
+        graphScene->setLevelOfDetail(LevelOfDetail::Full);
+    }
+
     scene->render(&p);
     p.end();
+
+    if (graphScene) graphScene->setLevelOfDetail(lod);
 }
 
 void
 GraphView::centerScene()
 {
-    auto* scene = this->scene();
+    auto* scene = nodeScene();
     if (!scene) return;
 
-    QRectF sceneRect = scene->itemsBoundingRect();
+    // objects of the scene may not be instantiated
+    QRectF sceneRect = scene->objectsBoundingRect();
 
     if (sceneRect.width()  > rect().width() ||
         sceneRect.height() > rect().height())
     {
         fitInView(sceneRect, Qt::KeepAspectRatio);
+        Impl::updateLevelOfDetail(*this);
     }
 
     centerOn(sceneRect.center());
+    Impl::updateVisibleRect(*this);
 }
 
 void
@@ -491,6 +533,21 @@ GraphView::mouseMoveEvent(QMouseEvent* event)
         }
     }
 // SPDX-SnippetEnd
+    Impl::updateVisibleRect(*this);
+}
+
+void
+GraphView::resizeEvent(QResizeEvent* event)
+{
+    GtGraphicsView::resizeEvent(event);
+    Impl::updateVisibleRect(*this);
+}
+
+void
+GraphView::scrollContentsBy(int dx, int dy)
+{
+    GtGraphicsView::scrollContentsBy(dx, dy);
+    Impl::updateVisibleRect(*this);
 }
 
 GraphScene*
@@ -103,6 +103,10 @@ protected:
 
     void mouseMoveEvent(QMouseEvent* event) override;
 
+    void resizeEvent(QResizeEvent* event) override;
+
+    void scrollContentsBy(int dx, int dy) override;
+
 private:
 
     /// hide grid API as is provides a poor interface
@@ -14,6 +14,7 @@
 #include "intelli/gui/nodepainter.h"
 #include "intelli/gui/nodegeometry.h"
 #include "intelli/gui/nodeuidata.h"
+#include "intelli/gui/graphscenedata.h"
 #include "intelli/gui/style.h"
 #include "intelli/gui/graphics/nodeobject.h"
 
@@ -211,6 +212,10 @@ NodePainter::drawPorts(QPainter& painter) const
     auto& object = this->object();
     auto& highlights = object.highlights();
 
+    // port captions are omitted when zoomed out
+    bool const drawCaptions =
+        object.sceneData().levelOfDetail == LevelOfDetail::Full;
+
     for (PortType type : {PortType::Out, PortType::In})
     {
         size_t const n = node.ports(type).size();
@@ -237,7 +242,7 @@ NodePainter::drawPorts(QPainter& painter) const
 
             drawPort(painter, *port, type, idx, flags);
 
-            if (!port->captionVisible) continue;
+            if (!drawCaptions || !port->captionVisible) continue;
 
             drawPortCaption(painter, *port, type, idx, flags);
 
@@ -357,15 +362,30 @@ NodePainter::drawIcon(QPainter& painter) const
     icon.paint(&painter, rect);
 }
 
+void
+NodePainter::drawSimplified(QPainter& painter) const
+{
+    auto& g = geometry();
+
+    applyBackgroundConfig(painter);
+    painter.drawRect(g.nodeBodyRect().united(g.nodeHeaderRect()));
+}
+
 void
 NodePainter::paint(QPainter& painter) const
 {
+    LevelOfDetail const lod = object().sceneData().levelOfDetail;
+
+    if (lod == LevelOfDetail::Minimal) return drawSimplified(painter);
+
     bool collapsed = object().isCollapsed();
 
-    drawBackground(painter);
+    drawBackground(painter, lod == LevelOfDetail::Full ?
+                                DefaultNodeRenderFlags :
+                                DrawNodeBackground | DrawNodeOutline);
 
     drawCaption(painter);
-    drawIcon(painter);
+    if (lod == LevelOfDetail::Full) drawIcon(painter);
 
     if (!collapsed) drawPorts(painter);
 
@@ -151,7 +151,8 @@ public:
 
     /**
      * @brief Calls `drawPort` for each port that is visible and
-     * `drawPortCaption` if the port caption is visible.
+     * `drawPortCaption` if the port caption is visible and the scene is
+     * rendered at full detail.
      * @param painter Painter to draw with
      */
     void drawPorts(QPainter& painter) const;
@@ -206,9 +207,17 @@ public:
      */
     void drawIcon(QPainter& painter) const;
 
+    /**
+     * @brief Draws the node as a plain rectangle using the background color.
+     * Used instead of all other components if the scene is zoomed out far
+     * (see `LevelOfDetail::Minimal`).
+     * @param painter Painter to draw with
+     */
+    void drawSimplified(QPainter& painter) const;
+
     /**
      * @brief Main paint method, used to draw all components in the right
-     * order.
+     * order. Respects the level of detail of the scene.
      * @param painter Painter to draw with
      */
     void paint(QPainter& painter) const;
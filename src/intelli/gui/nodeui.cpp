@@ -14,6 +14,7 @@
 #include "intelli/graph.h"
 #include "intelli/graphutilities.h"
 #include "intelli/node/dummy.h"
+#include "intelli/node/map.h"
 #include "intelli/node/groupinputprovider.h"
 #include "intelli/node/groupoutputprovider.h"
 #include "intelli/graphexecmodel.h"
@@ -37,6 +38,7 @@
 #include <gt_command.h>
 #include <gt_inputdialog.h>
 #include <gt_application.h>
+#include <gt_guiutilities.h>
 
 #include <QGraphicsProxyWidget>
 #include <QMessageBox>
@@ -134,6 +136,10 @@ NodeUI::NodeUI(Option option) :
         .setVisibilityMethod(toGraph)
         .setShortCut(gtApp->getShortCutSequence("clone"));
 
+    addSingleAction(tr("Open Body"), openMapBody)
+        .setIcon(gt::gui::icon::intelli::intelliGraph())
+        .setVisibilityMethod(toMapNode);
+
     addSingleAction(tr("Edit User Variables..."), editUserVariables)
         .setIcon(gt::gui::icon::variable())
         .setVisibilityMethod(isRootGraph);
@@ -414,6 +420,12 @@ NodeUI::toConstDynamicNode(GtObject const* obj)
     return qobject_cast<DynamicNode const*>(obj);;
 }
 
+MapNode*
+NodeUI::toMapNode(GtObject* obj)
+{
+    return qobject_cast<MapNode*>(obj);
+}
+
 bool
 NodeUI::isRootGraph(GtObject const* obj)
 {
@@ -585,6 +597,23 @@ NodeUI::editUserVariables(GtObject* obj)
     dialog.exec();
 }
 
+void
+NodeUI::openMapBody(GtObject* obj)
+{
+    MapNode* mapNode = toMapNode(obj);
+    if (!mapNode) return;
+
+    Graph* body = mapNode->body();
+    if (!body)
+    {
+        gtError() << tr("Failed to open the body of '%1'! (missing body)")
+                         .arg(relativeNodePath(*mapNode));
+        return;
+    }
+
+    gt::gui::handleObjectDoubleClick(*body);
+}
+
 void
 NodeUI::clearGraphNode(GtObject* obj)
 {
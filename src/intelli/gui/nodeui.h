@@ -29,6 +29,7 @@ class NodePainter;
 class NodeGraphicsObject;
 class Graph;
 class DynamicNode;
+class MapNode;
 
 class GT_INTELLI_EXPORT NodeUI : public GtObjectUI
 {
@@ -174,6 +175,14 @@ public:
     static DynamicNode* toDynamicNode(GtObject* obj);
     static DynamicNode const* toConstDynamicNode(GtObject const* obj);
 
+    /**
+     * @brief Casts the object to a map node object. Can be used for
+     * validation
+     * @param obj Object to cast
+     * @return map node object (may be null)
+     */
+    static MapNode* toMapNode(GtObject* obj);
+
     /**
      * @brief Returns whether this object is a root graph
      * @param obj Object to check
@@ -233,6 +242,14 @@ public:
      */
     static void editUserVariables(GtObject* obj);
 
+    /**
+     * @brief Opens the body of the map node `obj` in a separate graph editor.
+     * The body is evaluated once per element and is therefore not part of the
+     * graph hierarchy of the map node.
+     * @param obj Object must be a map node.
+     */
+    static void openMapBody(GtObject* obj);
+
     /**
      * @brief Returns the list of all port actions registered
      * @return
@@ -287,3 +287,16 @@ intelli::style::generateTypeColor(TypeId const& typeId)
     cache.insert(typeId, color);
     return color;
 }
+
+LevelOfDetail
+intelli::style::levelOfDetail(double scale)
+{
+    /// scale below which nodes are only drawn as plain rectangles
+    constexpr double minimalDetailScale = 0.3;
+    /// scale below which node details such as port captions are omitted
+    constexpr double reducedDetailScale = 0.55;
+
+    if (scale < minimalDetailScale) return LevelOfDetail::Minimal;
+    if (scale < reducedDetailScale) return LevelOfDetail::Reduced;
+    return LevelOfDetail::Full;
+}
@@ -43,6 +43,18 @@ nextConnectionShape(ConnectionShape shape)
     return ConnectionShape::DefaultShape;
 }
 
+/// enum for the level of detail used to render the objects of a graph scene
+enum class LevelOfDetail : size_t
+{
+    /// Nodes are drawn as plain rectangles and connections as straight lines
+    Minimal = 0,
+    /// Nodes are drawn without icons, port captions, widgets and drop shadows
+    Reduced,
+    /// All components are drawn
+    Full,
+    DefaultLevelOfDetail = Full
+};
+
 namespace style
 {
 
@@ -255,6 +267,14 @@ GT_INTELLI_EXPORT QColor invert(QColor const& color);
  * @return Color of the type id
  */
 GT_INTELLI_EXPORT QColor generateTypeColor(TypeId const& typeId);
+
+/**
+ * @brief Returns the level of detail that should be used to render a scene
+ * at the given scale (zoom factor).
+ * @param scale Scale of the view
+ * @return Level of detail
+ */
+GT_INTELLI_EXPORT LevelOfDetail levelOfDetail(double scale);
 }
 
 } // namespace intelli
@@ -10,6 +10,7 @@
 #include <intelli/gui/ui/node/logicnodeui.h>
 #include <intelli/gui/graphics/nodeobject.h>
 #include <intelli/gui/style.h>
+#include <intelli/gui/uiupdatedispatcher.h>
 #include <intelli/gui/utilities.h>
 #include <intelli/node/binarydisplay.h>
 #include <intelli/node/logicoperation.h>
@@ -409,7 +410,7 @@ LogicNodeUI::centralWidgetFactory(Node const& node) const
             wid->setMinimumSize(20 * digits, 20);
         };
 
-        QObject::connect(node, &Node::evaluated, wid, updateDisplay);
+        UiUpdateDispatcher::connect(node, &Node::evaluated, wid, updateDisplay);
         QObject::connect(node, &Node::portInserted, wid, updateDigitCount);
         QObject::connect(node, &Node::portDeleted, wid, updateDigitCount);
         QObject::connect(gtApp, &GtApplication::themeChanged, wid, updateStyle);
@@ -9,6 +9,7 @@
 
 #include <intelli/node/numberdisplay.h>
 #include <intelli/gui/graphics/nodeobject.h>
+#include <intelli/gui/uiupdatedispatcher.h>
 
 #include <gt_lineedit.h>
 
@@ -36,7 +37,7 @@ NumberDisplayNodeUI::centralWidgetFactory(Node const& n) const
             w_->setText(QString::number(node->displayValue()));
         };
 
-        QObject::connect(node, &Node::evaluated, w.get(), updateText);
+        UiUpdateDispatcher::connect(node, &Node::evaluated, w.get(), updateText);
         updateText();
 
         return convertToGraphicsWidget(std::move(w), object);
@@ -8,6 +8,7 @@
 #include <intelli/gui/ui/node/objectinputnodeui.h>
 
 #include <intelli/gui/graphics/nodeobject.h>
+#include <intelli/gui/uiupdatedispatcher.h>
 #include <intelli/node/input/objectinput.h>
 #include <intelli/nodedatainterface.h>
 
@@ -38,12 +39,14 @@ ObjectInputNodeUI::centralWidgetFactory(Node const& n) const
         auto updateText = [w_ = w.get()]() {
             w_->updateText();
         };
+        auto update = [=]() {
+            updateScope();
+            updateText();
+        };
 
-        QObject::connect(node, &Node::evaluated, w.get(), updateScope);
-        QObject::connect(node, &Node::evaluated, w.get(), updateText);
+        UiUpdateDispatcher::connect(node, &Node::evaluated, w.get(), update);
 
-        updateScope();
-        updateText();
+        update();
 
         return convertToGraphicsWidget(std::move(w), object);
     };
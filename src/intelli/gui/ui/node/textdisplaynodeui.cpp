@@ -9,6 +9,7 @@
 
 #include <intelli/gui/graphics/nodeobject.h>
 #include <intelli/gui/utilities.h>
+#include <intelli/gui/uiupdatedispatcher.h>
 #include <intelli/node/textdisplay.h>
 
 #include <gt_application.h>
@@ -23,6 +24,7 @@
 #include <QTextDocument>
 
 #include <cassert>
+#include <memory>
 
 using namespace intelli;
 
@@ -70,11 +72,16 @@ TextDisplayNodeUI::centralWidgetFactory(Node const& n) const
             }
         };
 
-        auto const updateText = [node, w]() {
-            w->setPlainText(node->displayText());
+        // avoid relayouting the document if the text did not change
+        auto const updateText = [node, w, lastText = std::make_shared<QString>()]() {
+            QString text = node->displayText();
+            if (*lastText == text) return;
+
+            *lastText = text;
+            w->setPlainText(text);
         };
 
-        QObject::connect(node, &Node::inputDataRecieved, w, updateText);
+        UiUpdateDispatcher::connect(node, &Node::inputDataRecieved, w, updateText);
         QObject::connect(node,
                          qOverload<GtObject*, GtAbstractProperty*>(&Node::dataChanged),
                          w,
@@ -0,0 +1,148 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include <intelli/gui/uiupdatedispatcher.h>
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QGraphicsItem>
+#include <QPointer>
+#include <QThread>
+#include <QTimer>
+
+#include <algorithm>
+#include <vector>
+
+using namespace intelli;
+
+struct UiUpdateDispatcher::Impl
+{
+    struct Entry
+    {
+        /// Context object, callback is discarded if deleted
+        QPointer<QObject> context;
+        /// Callback to invoke
+        std::function<void()> callback;
+    };
+
+    /// Scheduled updates
+    std::vector<Entry> updates;
+    /// Items that are animated using the shared clock
+    std::vector<QGraphicsItem*> animations;
+    /// Frame timer
+    QTimer timer;
+    /// Shared animation clock
+    QElapsedTimer clock;
+    /// Frames per second
+    int frameRate = DefaultFrameRate;
+
+    /// Starts the frame timer if it is not running yet
+    void requestFrame()
+    {
+        if (!timer.isActive()) timer.start();
+    }
+};
+
+UiUpdateDispatcher::UiUpdateDispatcher(QObject* parent) :
+    QObject(parent),
+    pimpl(std::make_unique<Impl>())
+{
+    pimpl->timer.setSingleShot(true);
+    pimpl->timer.setTimerType(Qt::PreciseTimer);
+    pimpl->timer.setInterval(1000 / pimpl->frameRate);
+    pimpl->clock.start();
+
+    connect(&pimpl->timer, &QTimer::timeout,
+            this, &UiUpdateDispatcher::onFrame);
+}
+
+UiUpdateDispatcher::~UiUpdateDispatcher() = default;
+
+UiUpdateDispatcher*
+UiUpdateDispatcher::instance()
+{
+    // reset once the application object is destroyed
+    static QPointer<UiUpdateDispatcher> self;
+    if (!self)
+    {
+        auto* app = QCoreApplication::instance();
+        if (!app || QThread::currentThread() != app->thread()) return nullptr;
+
+        self = new UiUpdateDispatcher(app);
+    }
+    return self;
+}
+
+void
+UiUpdateDispatcher::schedule(QObject& context, std::function<void()> callback)
+{
+    assert(QThread::currentThread() == thread());
+
+    pimpl->updates.push_back({&context, std::move(callback)});
+    pimpl->requestFrame();
+}
+
+int
+UiUpdateDispatcher::frameRate() const
+{
+    return pimpl->frameRate;
+}
+
+void
+UiUpdateDispatcher::startAnimation(QGraphicsItem& item)
+{
+    auto& animations = pimpl->animations;
+    if (std::find(animations.begin(), animations.end(), &item) != animations.end())
+    {
+        return;
+    }
+
+    animations.push_back(&item);
+    pimpl->requestFrame();
+}
+
+void
+UiUpdateDispatcher::stopAnimation(QGraphicsItem& item)
+{
+    auto& animations = pimpl->animations;
+    animations.erase(std::remove(animations.begin(), animations.end(), &item),
+                     animations.end());
+}
+
+double
+UiUpdateDispatcher::animationProgress(int duration) const
+{
+    if (duration <= 0) return 0.0;
+
+    return (double)(pimpl->clock.elapsed() % duration) / duration;
+}
+
+void
+UiUpdateDispatcher::onFrame()
+{
+    // callbacks may schedule new updates
+    std::vector<Impl::Entry> updates;
+    std::swap(updates, pimpl->updates);
+
+    for (Impl::Entry& entry : updates)
+    {
+        if (entry.context) entry.callback();
+    }
+
+    for (QGraphicsItem* item : pimpl->animations)
+    {
+        item->update();
+    }
+
+    // keep ticking while there is something to do
+    if (!pimpl->updates.empty() || !pimpl->animations.empty())
+    {
+        pimpl->requestFrame();
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_UIUPDATEDISPATCHER_H
+#define GT_INTELLI_UIUPDATEDISPATCHER_H
+
+#include <intelli/exports.h>
+
+#include <QObject>
+
+#include <functional>
+#include <memory>
+
+class QGraphicsItem;
+
+namespace intelli
+{
+
+/**
+ * @brief Central dispatcher for UI updates, that are triggered at a high
+ * frequency (e.g. by an auto-evaluating graph). Updates are coalesced and
+ * dispatched at most once per frame. Additionally provides a shared animation
+ * clock, that drives all running animations using a single timer.
+ * Must only be accessed from the GUI thread. The dispatcher is owned by the
+ * application object and is destroyed together with it.
+ */
+class GT_INTELLI_EXPORT UiUpdateDispatcher : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    /// Default number of frames per second
+    static constexpr int DefaultFrameRate = 30;
+
+    /**
+     * @brief Returns the instance of the dispatcher. The instance is created
+     * on demand as a child of the application object.
+     * @return Dispatcher (null if no application object exists or if called
+     * outside of the GUI thread)
+     */
+    static UiUpdateDispatcher* instance();
+
+    ~UiUpdateDispatcher();
+
+    /**
+     * @brief Connects the `signal` of `sender` to `functor` such that the
+     * functor is invoked at most once per frame, regardless of how often the
+     * signal was emitted in the meantime. Arguments of the signal are
+     * discarded. The functor is not invoked if `context` is deleted.
+     * @param sender Sender object
+     * @param signal Signal
+     * @param context Context object, determines the lifetime of the connection
+     * @param functor Functor to invoke, must not accept any arguments
+     * @return Connection
+     */
+    template <typename Sender, typename Signal, typename Functor>
+    static QMetaObject::Connection
+    connect(Sender const* sender, Signal signal, QObject* context, Functor functor)
+    {
+        // shared between all invocations of this connection
+        auto pending = std::make_shared<bool>(false);
+
+        std::function<void()> callback = [pending, f = std::move(functor)](){
+            *pending = false;
+            f();
+        };
+
+        return QObject::connect(sender, signal, context, [context, pending, callback](){
+            if (*pending) return;
+            auto* dispatcher = instance();
+            if (!dispatcher) return;
+
+            *pending = true;
+            dispatcher->schedule(*context, callback);
+        });
+    }
+
+    /**
+     * @brief Schedules `callback` to be invoked once the next frame is
+     * dispatched. The callback is not invoked if `context` is deleted.
+     * Does not coalesce callbacks, use `connect` for this purpose.
+     * @param context Context object
+     * @param callback Callback to invoke
+     */
+    void schedule(QObject& context, std::function<void()> callback);
+
+    /**
+     * @brief Returns the maximum number of frames per second
+     * @return Frames per second
+     */
+    int frameRate() const;
+
+    /**
+     * @brief Registers the item for the shared animation clock. The item is
+     * updated every frame until `stopAnimation` is called. Use
+     * `animationProgress` to access the current state of the animation when
+     * painting.
+     * @param item Item to animate. Must call `stopAnimation` before it is
+     * deleted.
+     */
+    void startAnimation(QGraphicsItem& item);
+
+    /**
+     * @brief Unregisters the item from the shared animation clock.
+     * @param item Item to no longer animate
+     */
+    void stopAnimation(QGraphicsItem& item);
+
+    /**
+     * @brief Returns the progress of a looping animation of the shared
+     * animation clock.
+     * @param duration Duration of a single loop in ms
+     * @return Progress in the range [0, 1)
+     */
+    double animationProgress(int duration = 1000) const;
+
+private:
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+
+    explicit UiUpdateDispatcher(QObject* parent);
+
+    /// Dispatches all scheduled updates and animations
+    void onFrame();
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_UIUPDATEDISPATCHER_H
@@ -12,15 +12,21 @@
 #include "intelli/nodedatafactory.h"
 #include "intelli/nodedatainterface.h"
 #include "intelli/graphuservariables.h"
+#include "intelli/exec/asyncexecutor.h"
 #include "intelli/exec/detachedexecutor.h"
+#include "intelli/exec/processexecutor.h"
 #include "intelli/private/node_impl.h"
 #include "intelli/private/utils.h"
 
 #include <gt_qtutilities.h>
 #include <gt_coreapplication.h>
 
+#include <QHash>
+#include <QMutex>
+#include <QPointer>
 #include <QRegExpValidator>
 #include <QVBoxLayout>
+#include <QWaitCondition>
 
 using namespace intelli;
 
@@ -244,6 +250,101 @@ Node::nodeEvalMode() const
     return pimpl->evalMode;
 }
 
+void
+Node::setResources(NodeResources resources)
+{
+    pimpl->resources = [r = std::move(resources)](){ return r; };
+}
+
+void
+Node::setResources(ResourceFunction function)
+{
+    pimpl->resources = std::move(function);
+}
+
+NodeResources
+Node::resources() const
+{
+    if (!pimpl->resources) return {};
+    return pimpl->resources();
+}
+
+void
+Node::setCacheVersion(int version)
+{
+    pimpl->cacheVersion = version;
+}
+
+int
+Node::cacheVersion() const
+{
+    return pimpl->cacheVersion;
+}
+
+void
+Node::addPortDependency(PortId inPortId, PortId outPortId)
+{
+    if (portType(inPortId) != PortType::In ||
+        portType(outPortId) != PortType::Out)
+    {
+        gtWarning()
+            << utils::logId(*this)
+            << tr("Failed to add port dependency, invalid ports (%1 -> %2)!")
+                   .arg(inPortId).arg(outPortId);
+        return;
+    }
+
+    auto& dependencies = pimpl->portDependencies;
+    auto dependency = std::make_pair(inPortId, outPortId);
+    if (utils::contains(dependencies, dependency)) return;
+
+    dependencies.push_back(dependency);
+}
+
+std::vector<PortId>
+Node::dependentOutPorts(PortId inPortId) const
+{
+    std::vector<PortId> outPorts;
+    for (auto const& dependency : pimpl->portDependencies)
+    {
+        if (dependency.first == inPortId) outPorts.push_back(dependency.second);
+    }
+
+    if (!outPorts.empty()) return outPorts;
+
+    // input affects all outputs
+    for (PortInfo const& port : ports(PortType::Out))
+    {
+        outPorts.push_back(port.id());
+    }
+    return outPorts;
+}
+
+bool
+Node::hasPortDependencies() const
+{
+    return !pimpl->portDependencies.empty();
+}
+
+void
+Node::setInputDemand(InputDemandFunction function)
+{
+    pimpl->inputDemand = std::move(function);
+}
+
+std::vector<PortId>
+Node::demandedInputs() const
+{
+    if (pimpl->inputDemand) return pimpl->inputDemand();
+
+    std::vector<PortId> demanded;
+    for (PortInfo const& port : ports(PortType::In))
+    {
+        if (port.lazy) demanded.push_back(port.id());
+    }
+    return demanded;
+}
+
 void
 Node::setToolTip(QString const& tooltip)
 {
@@ -383,6 +484,12 @@ Node::removePort(PortId id)
 
     port.ports->erase(std::next(port.ports->begin(), port.idx));
 
+    auto& dependencies = pimpl->portDependencies;
+    dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(),
+                                      [id](auto const& dependency){
+        return dependency.first == id || dependency.second == id;
+    }), dependencies.end());
+
     return true;
 }
 
@@ -512,6 +619,13 @@ Node::eval()
     // nothing to do here
 }
 
+void
+Node::evalAsync(EvalPromise promise)
+{
+    eval();
+    promise.finish();
+}
+
 void
 Node::evalFailed()
 {
@@ -527,6 +641,31 @@ Node::evalFailed()
     model->setNodeEvaluationFailed(uuid());
 }
 
+bool
+Node::isEvaluationCanceled() const
+{
+    NodeDataInterface* model = pimpl->dataInterface;
+    return model && model->isEvaluationCanceled(uuid());
+}
+
+bool
+Node::parallelFor(size_t count,
+                  std::function<void(size_t, size_t)> const& func,
+                  size_t grainSize) const
+{
+    return exec::parallelFor(count, func, parallelOptions(grainSize));
+}
+
+exec::ParallelOptions
+Node::parallelOptions(size_t grainSize) const
+{
+    exec::ParallelOptions options;
+    options.grainSize = grainSize;
+    // polled by the evaluating thread only
+    options.isCanceled = [this](){ return isEvaluationCanceled(); };
+    return options;
+}
+
 void
 Node::registerWidgetFactory(WidgetFactory factory)
 {
@@ -556,9 +695,74 @@ public:
     inline static void
     evaluateNode(Node& node)
     {
+        if ((size_t)node.nodeEvalMode() & IsAsyncMask)
+        {
+            return awaitAsyncEvaluation(node);
+        }
         node.eval();
     }
 
+    inline static void
+    evaluateNodeAsync(Node& node, EvalPromise promise)
+    {
+        node.evalAsync(std::move(promise));
+    }
+
+    /// Evaluates an asynchronous node synchronously, i.e. blocks the calling
+    /// thread until the promise is completed. No events are processed while
+    /// waiting, thus the node must complete the promise from an other thread
+    /// (or before `evalAsync` returns).
+    static void
+    awaitAsyncEvaluation(Node& node)
+    {
+        struct Result
+        {
+            QMutex mutex;
+            QWaitCondition condition;
+            NodeDataPtrList data;
+            bool finished = false;
+            bool success = false;
+        };
+
+        auto result = std::make_shared<Result>();
+
+        // the promise may outlive the node
+        QPointer<Node> nodePtr{&node};
+        auto isCanceled = [nodePtr](){
+            return !nodePtr || nodePtr->isEvaluationCanceled();
+        };
+
+        auto onFinished = [result](NodeDataPtrList data, bool success){
+            QMutexLocker locker{&result->mutex};
+            result->data = std::move(data);
+            result->success = success;
+            result->finished = true;
+            result->condition.wakeAll();
+        };
+
+        node.evalAsync(EvalPromise::make(std::move(isCanceled),
+                                         std::move(onFinished)));
+
+        {
+            QMutexLocker locker{&result->mutex};
+            while (!result->finished) result->condition.wait(&result->mutex);
+        }
+
+        NodeDataInterface* model = node.pimpl->dataInterface;
+        if (!model) return;
+
+        if (!result->success)
+        {
+            model->setNodeEvaluationFailed(node.uuid());
+            return;
+        }
+
+        if (!result->data.empty())
+        {
+            model->setNodeData(node.uuid(), PortType::Out, result->data);
+        }
+    }
+
     inline static void
     setNodeDataInterface(Node& node, NodeDataInterface* interface)
     {
@@ -590,6 +794,14 @@ public:
         if (evalMode == NodeEvalMode::NoEvaluationRequired) return true;
 
         size_t evalFlag = (size_t)node.nodeEvalMode();
+        if (evalFlag & IsAsyncMask)
+        {
+            return exec::asyncEvaluation(node);
+        }
+        if (evalFlag & IsIsolatedMask)
+        {
+            return exec::isolatedEvaluation(node);
+        }
         if (evalFlag & IsDetachedMask)
         {
             return exec::detachedEvaluation(node);
@@ -657,6 +869,57 @@ intelli::exec::detachedEvaluation(Node& node, NodeDataInterface* model)
     return true;
 }
 
+bool
+intelli::exec::isolatedEvaluation(Node& node, NodeDataInterface* model)
+{
+    if (!::updateNodeDataInterface(node, model)) return false;
+
+    auto executor = node.findChild<ProcessExecutor*>();
+    if (executor && !executor->canEvaluateNode())
+    {
+        gtError() << utils::logId(node)
+                  << QObject::tr("Failed to evaluate node! (Node is already executing)");
+        return false;
+    }
+
+    if (!executor) executor = new ProcessExecutor(&node);
+
+    if (!executor->evaluateNode(node))
+    {
+        delete executor;
+        return false;
+    }
+
+    return true;
+}
+
+bool
+intelli::exec::asyncEvaluation(Node& node, NodeDataInterface* model)
+{
+    if (!::updateNodeDataInterface(node, model)) return false;
+
+    auto executor = node.findChild<AsyncExecutor*>();
+    if (executor && !executor->canEvaluateNode())
+    {
+        gtError() << utils::logId(node)
+                  << QObject::tr("Failed to evaluate node! (Node is already executing)");
+        return false;
+    }
+
+    if (!executor) executor = new AsyncExecutor(&node);
+
+    EvalPromise promise = executor->evaluateNode(node);
+    if (!promise.isValid())
+    {
+        delete executor;
+        return false;
+    }
+
+    INode::evaluateNodeAsync(node, std::move(promise));
+
+    return true;
+}
+
 bool
 intelli::exec::blockingEvaluation(Node& node, NodeDataInterface* model)
 {
@@ -679,6 +942,15 @@ intelli::exec::blockingEvaluation(Node& node, NodeDataInterface* model)
     return true;
 }
 
+bool
+intelli::exec::silentEvaluation(Node& node, NodeDataInterface& model)
+{
+    INode::setNodeDataInterface(node, &model);
+    INode::evaluateNode(node);
+
+    return true;
+}
+
 bool
 intelli::exec::triggerNodeEvaluation(Node& node, NodeDataInterface* model)
 {
@@ -693,8 +965,63 @@ intelli::exec::setNodeDataInterface(Node& node, NodeDataInterface* model)
     return INode::setNodeDataInterface(node, model);
 }
 
+bool
+intelli::exec::cancelEvaluation(Node& node)
+{
+    if (auto executor = node.findChild<ProcessExecutor*>())
+    {
+        return executor->cancel();
+    }
+    if (auto executor = node.findChild<AsyncExecutor*>())
+    {
+        if (executor->cancel()) return true;
+    }
+    auto executor = node.findChild<DetachedExecutor*>();
+    return executor && executor->cancel();
+}
+
 NodeDataInterface*
 intelli::exec::nodeDataInterface(Node& node)
 {
     return INode::nodeDataInterface(node);
 }
+
+namespace
+{
+
+struct ResourceCapacities
+{
+    QMutex mutex;
+    QHash<QString, size_t> capacities;
+};
+
+ResourceCapacities& resourceCapacities()
+{
+    static ResourceCapacities self;
+    return self;
+}
+
+} // namespace
+
+void
+intelli::exec::setResourceCapacity(QString const& name, size_t capacity)
+{
+    auto& self = resourceCapacities();
+    QMutexLocker locker{&self.mutex};
+
+    if (capacity == 0)
+    {
+        self.capacities.remove(name);
+        return;
+    }
+    self.capacities.insert(name, capacity);
+}
+
+size_t
+intelli::exec::resourceCapacity(QString const& name)
+{
+    auto& self = resourceCapacities();
+    QMutexLocker locker{&self.mutex};
+
+    return self.capacities.value(name, 0);
+}
@@ -12,6 +12,8 @@
 
 #include <intelli/globals.h>
 #include <intelli/exports.h>
+#include <intelli/parallel.h>
+#include <intelli/evalpromise.h>
 
 #include <gt_typetraits.h>
 #include <gt_object.h>
@@ -37,6 +39,16 @@ enum NodeFlag : size_t
     ResizableHOnly = 1 << 6,
     /// Indicates node is deprecated and should no longer be used
     Deprecated = 1 << 7,
+    /// Indicates node is a sink, i.e. it exports data out of the graph.
+    /// Sinks are the targets of a demand-driven evaluation. Nodes that neither
+    /// contribute to a sink nor are a sink themselves are not evaluated, thus
+    /// every node with side effects (e.g. writing files, modifying objects, or
+    /// running calculators) must be flagged as a sink.
+    Sink = 1 << 8,
+    /// Indicates that the results of the node only depend on its properties
+    /// and inputs. Thus they may be loaded from the node result cache of the
+    /// execution model instead of evaluating the node (see `NodeResultCache`).
+    Cacheable = 1 << 9,
     /// default node flags
     DefaultNodeFlags = NoFlag,
 
@@ -56,6 +68,10 @@ constexpr size_t IsDetachedMask = 1 << 0;
 constexpr size_t IsBlockingMask = 1 << 1;
 /// mask to check if node should be evaluated exclusively
 constexpr size_t IsExclusiveMask = 1 << 2;
+/// mask to check if node should be evaluated in a separate process
+constexpr size_t IsIsolatedMask = 1 << 4;
+/// mask to check if node should be evaluated asynchronously
+constexpr size_t IsAsyncMask = 1 << 5;
 
 enum class NodeEvalMode : size_t
 {
@@ -75,6 +91,15 @@ enum class NodeEvalMode : size_t
     /// Inidcates that the inputs of the node should be forwarded to the outputs
     /// of the node
     ForwardInputsToOutputs = 1 << 3 | IsBlockingMask,
+    /// Indicates that the node should be evaluated non blockingly in a
+    /// separate worker process (see `exec::isolatedEvaluation`). Intended for
+    /// nodes that are not thread-safe or may crash the application.
+    Isolated = IsIsolatedMask | IsDetachedMask,
+    /// Indicates that the node is evaluated asynchronously using
+    /// `Node::evalAsync`, i.e. it starts its work in the main thread and
+    /// completes later without occupying a thread. Intended for I/O-bound
+    /// nodes (see `exec::asyncEvaluation`).
+    Async = IsAsyncMask,
     /// Default behaviour
     Default = Detached,
 
@@ -84,6 +109,32 @@ enum class NodeEvalMode : size_t
     MainThread [[deprecated("Use `Blocking` instead")]] = Blocking,
 };
 
+/// Access mode of a node resource
+enum class ResourceAccess
+{
+    /// Resource may be accessed by multiple nodes simultaneously (e.g. reading
+    /// a file). The number of nodes may be limited by the resource's capacity.
+    Shared = 0,
+    /// Resource may only be accessed by a single node (e.g. writing a file)
+    Exclusive
+};
+
+/**
+ * @brief Resource token that must be acquired before a node can be evaluated.
+ * Resources are identified by name, e.g. `file:<path>` or
+ * `calculator:<class>`. Nodes that do not contend for the same resources may
+ * be evaluated concurrently.
+ */
+struct NodeResource
+{
+    /// name of the resource
+    QString name;
+    /// access mode
+    ResourceAccess access = ResourceAccess::Exclusive;
+};
+
+using NodeResources = std::vector<NodeResource>;
+
 class INode;
 class Node;
 class NodeData;
@@ -113,6 +164,44 @@ GT_INTELLI_EXPORT bool blockingEvaluation(Node& node, NodeDataInterface* model =
  */
 GT_INTELLI_EXPORT bool detachedEvaluation(Node& node, NodeDataInterface* model = nullptr);
 
+/**
+ * @brief Evaluates the node in a separate worker process (asyncronously). The
+ * node and its input data are transferred to an idle worker of the worker
+ * pool, thus all input and output data must support serialization (see
+ * `NodeData::serialize`). Custom signals of the node are not forwarded and the
+ * scope object is not available during evaluation. A valid node data interface
+ * must either be set already or supplied or as an argument.
+ * @param node Node to evaluate asyncronously
+ * @param model Optional node data interface. If none is supplied the registered
+ * node interface ist used (accessed using `nodeDataInterface`).
+ * @return success
+ */
+GT_INTELLI_EXPORT bool isolatedEvaluation(Node& node, NodeDataInterface* model = nullptr);
+
+/**
+ * @brief Evaluates the node asynchronously using `Node::evalAsync`. The node
+ * starts its work in the current thread and completes the evaluation later
+ * using a promise, which may be completed from any thread. No thread is
+ * occupied while waiting for the completion. A valid node data interface must
+ * either be set already or supplied or as an argument.
+ * @param node Node to evaluate asyncronously
+ * @param model Optional node data interface. If none is supplied the registered
+ * node interface ist used (accessed using `nodeDataInterface`).
+ * @return success
+ */
+GT_INTELLI_EXPORT bool asyncEvaluation(Node& node, NodeDataInterface* model = nullptr);
+
+/**
+ * @brief Evaluates the node in the current thread. Other than
+ * `blockingEvaluation`, no signals are emitted and the node data interface is
+ * not notified about the start and end of the evaluation. Intended for
+ * executors that do not track eval states (e.g. `PlanExecutor`).
+ * @param node Node to evaluate
+ * @param model Node data interface
+ * @return success
+ */
+GT_INTELLI_EXPORT bool silentEvaluation(Node& node, NodeDataInterface& model);
+
 /**
  * @brief Triggers the evaluation of the node. Choses whether to evaluate the
  * node asyncronously or blocking according to the node's eval mode. A valid
@@ -133,6 +222,16 @@ GT_INTELLI_EXPORT bool triggerNodeEvaluation(Node& node, NodeDataInterface* mode
  */
 GT_INTELLI_EXPORT void setNodeDataInterface(Node& node, NodeDataInterface* model);
 
+/**
+ * @brief Requests the cancellation of the running detached evaluation of the
+ * node. The evaluation is canceled cooperatively, i.e. the node must poll
+ * `Node::isEvaluationCanceled`. Isolated evaluations are canceled by
+ * terminating the worker process. The results of the evaluation are discarded.
+ * @param node Node to cancel
+ * @return Whether a running evaluation was canceled
+ */
+GT_INTELLI_EXPORT bool cancelEvaluation(Node& node);
+
 /**
  * @brief Returns the registered node data interface of the given node.
  * The node data interface must be set during execution to access input and
@@ -142,6 +241,55 @@ GT_INTELLI_EXPORT void setNodeDataInterface(Node& node, NodeDataInterface* model
  */
 GT_INTELLI_EXPORT NodeDataInterface* nodeDataInterface(Node& node);
 
+/**
+ * @brief Sets the max. number of nodes that may access the resource `name`
+ * simultaneously using shared access. Applies to all execution models.
+ * @param name Name of the resource (e.g. `calculator:<class>`)
+ * @param capacity Capacity. Zero resets the capacity to unlimited.
+ */
+GT_INTELLI_EXPORT void setResourceCapacity(QString const& name, size_t capacity);
+
+/**
+ * @brief Returns the max. number of nodes that may access the resource `name`
+ * simultaneously using shared access.
+ * @param name Name of the resource
+ * @return Capacity. Zero denotes an unlimited capacity.
+ */
+GT_INTELLI_EXPORT size_t resourceCapacity(QString const& name);
+
+/**
+ * @brief Sets the program that is launched for each worker process of the
+ * worker pool (see `isolatedEvaluation`). The program must call `runWorker`
+ * once the node and data classes are registered. Running workers are not
+ * affected.
+ * @param program Path to the program
+ * @param arguments Arguments passed to the program
+ */
+GT_INTELLI_EXPORT void setWorkerProgram(QString const& program,
+                                        QStringList const& arguments = {});
+
+/**
+ * @brief Sets the max. number of worker processes, i.e. the max. number of
+ * nodes that are evaluated in separate processes simultaneously.
+ * @param count Max. number of workers. Zero resets the count to the number of
+ * cores.
+ */
+GT_INTELLI_EXPORT void setMaxWorkerCount(size_t count);
+
+/**
+ * @brief Returns the max. number of worker processes.
+ * @return Max. number of workers
+ */
+GT_INTELLI_EXPORT size_t maxWorkerCount();
+
+/**
+ * @brief Entry point of a worker process. Evaluates the nodes that are
+ * received through the standard input until the input is closed. Requires a
+ * `QCoreApplication` instance.
+ * @return Exit code
+ */
+GT_INTELLI_EXPORT int runWorker();
+
 } // namespace exec
 
 /**
@@ -202,6 +350,13 @@ public:
         std::function<std::unique_ptr<QWidget>(Node& thisNode)>;
     using WidgetFactoryNoArgs =
         std::function<std::unique_ptr<QWidget>()>;
+    /// function type for determining the resources of a node. Invoked before
+    /// each evaluation in the main thread.
+    using ResourceFunction = std::function<NodeResources()>;
+    /// function type for determining the lazy input ports, whose data is
+    /// required for the next evaluation. Invoked in the main thread once all
+    /// non-lazy inputs are valid.
+    using InputDemandFunction = std::function<std::vector<PortId>()>;
 
     /// Enums inidacting of node event
     enum NodeEventType
@@ -288,6 +443,7 @@ public:
             swap(captionVisible, other.captionVisible);
             swap(visible, other.visible);
             swap(optional, other.optional);
+            swap(lazy, other.lazy);
             swap(m_isConnected, other.m_isConnected);
             swap(m_id, other.m_id);
         }
@@ -298,6 +454,7 @@ public:
         PortInfo& setCaptionVisible(bool v) { captionVisible = v; return *this; }
         PortInfo& setVisible(bool v) { visible = v; return *this; }
         PortInfo& setOptional(bool v) { optional = v; return *this; }
+        PortInfo& setLazy(bool v) { lazy = v; return *this; }
 
         /// type id for port data (classname)
         TypeId typeId;
@@ -311,6 +468,9 @@ public:
         bool visible = true;
         /// whether the port is required for the node evaluation
         bool optional = true;
+        /// whether the input port is evaluated lazily, i.e. its predecessors
+        /// are only evaluated if the data is demanded by the node
+        bool lazy = false;
 
         /**
          * @brief Returns the port id
@@ -414,6 +574,45 @@ public:
      */
     NodeEvalMode nodeEvalMode() const;
 
+    /**
+     * @brief Returns the resources, that must be acquired before this node can
+     * be evaluated. Nodes that declare resources are only serialized with nodes
+     * that contend for the same resources.
+     * @return Node resources
+     */
+    NodeResources resources() const;
+
+    /**
+     * @brief Returns the version of the node's implementation, that is part of
+     * the key of its results in the node result cache.
+     * @return Cache version
+     */
+    int cacheVersion() const;
+
+    /**
+     * @brief Returns the output ports that depend on the given input port,
+     * i.e. the outputs that are outdated once the input changes. Inputs for
+     * which no dependencies were declared affect all outputs.
+     * @param inPortId Input port
+     * @return Dependent output ports
+     */
+    std::vector<PortId> dependentOutPorts(PortId inPortId) const;
+
+    /**
+     * @brief Returns whether the node declared any port dependencies
+     * @return Has port dependencies
+     */
+    bool hasPortDependencies() const;
+
+    /**
+     * @brief Returns the lazy input ports, whose data is required for the next
+     * evaluation. Only the predecessors of these ports are evaluated.
+     * Should only be called once all non-lazy inputs are valid. By default all
+     * lazy input ports are demanded.
+     * @return Demanded input ports
+     */
+    std::vector<PortId> demandedInputs() const;
+
     /**
      * @brief Return the node eval state
      * @return Node eval state
@@ -666,11 +865,77 @@ protected:
      */
     virtual void eval();
 
+    /**
+     * @brief Evaluation method of asynchronous nodes (see
+     * `NodeEvalMode::Async`). Is called in the thread of the node and should
+     * only start the work (e.g. launch a process) and return immediately. The
+     * outputs are set using the promise, which must be completed once the
+     * work is done. Should poll `EvalPromise::isCanceled`. If the node is
+     * evaluated synchronously (e.g. within a detached evaluation), the calling
+     * thread is blocked until the promise is completed without processing
+     * events, thus the work must not rely on the event loop of the node's
+     * thread in this case. The default implementation calls
+     * `eval` and finishes the promise.
+     * @param promise Promise to complete the evaluation with
+     */
+    virtual void evalAsync(EvalPromise promise);
+
     /**
      * @brief Can be called to indicate that the node evaluation failed.
      */
     void evalFailed();
 
+    /**
+     * @brief Returns whether the current evaluation was canceled, e.g. because
+     * the inputs changed in the meantime. Long running nodes should poll this
+     * flag within `eval` and return early, the results of a canceled
+     * evaluation are discarded.
+     * @return Is canceled
+     */
+    bool isEvaluationCanceled() const;
+
+    /**
+     * @brief Invokes `func` for all indices in the range [0, count) in
+     * parallel (see `exec::parallelFor`). Only threads of the global thread
+     * pool, that are idle at the time of the call, are used. Blocks until all
+     * chunks are processed. Remaining chunks are skipped once the evaluation
+     * is canceled. Should only be called within `eval`.
+     * @param count Number of indices
+     * @param func Function invoked for each chunk with the range [begin, end)
+     * @param grainSize Number of indices per chunk. Zero determines the grain
+     * size automatically.
+     * @return Whether all chunks were processed, i.e. false if canceled
+     */
+    bool parallelFor(size_t count,
+                     std::function<void(size_t begin, size_t end)> const& func,
+                     size_t grainSize = 0) const;
+
+    /**
+     * @brief Reduces the range [0, count) in parallel (see
+     * `exec::parallelReduce`). Remaining chunks are skipped once the
+     * evaluation is canceled. Should only be called within `eval`.
+     * @param count Number of indices
+     * @param identity Initial value of the result and of each partial result
+     * @param map Function returning the partial result of the range [begin, end)
+     * @param reduce Function combining two results
+     * @param grainSize Number of indices per chunk. Zero determines the grain
+     * size automatically.
+     * @return Result (null if canceled)
+     */
+    template <typename T, typename Map, typename Reduce>
+    tl::optional<T> parallelReduce(size_t count,
+                                   T identity,
+                                   Map map,
+                                   Reduce reduce,
+                                   size_t grainSize = 0) const
+    {
+        return exec::parallelReduce(count,
+                                    std::move(identity),
+                                    std::move(map),
+                                    std::move(reduce),
+                                    parallelOptions(grainSize));
+    }
+
     /**
      * @brief Should be called within the constructor. Used to register
      * the widget factory, used for creating the embedded widget within the
@@ -707,6 +972,50 @@ protected:
      */
     void setNodeEvalMode(NodeEvalMode mode);
 
+    /**
+     * @brief Sets the resources of this node. Should be preferred over
+     * an exclusive eval mode, as only nodes contending for the same resources
+     * are serialized.
+     * @param resources Resources to acquire before each evaluation
+     */
+    void setResources(NodeResources resources);
+
+    /**
+     * @brief Overload, that accepts a function for determining the resources
+     * dynamically, e.g. if the resource depends on the input data.
+     * @param function Function, that returns the resources to acquire
+     */
+    void setResources(ResourceFunction function);
+
+    /**
+     * @brief Sets the version of the node's implementation. Must be
+     * incremented whenever a change to the node alters its results, such that
+     * results cached by previous versions are no longer loaded (see
+     * `NodeFlag::Cacheable`). Should be called in the constructor.
+     * @param version Cache version
+     */
+    void setCacheVersion(int version);
+
+    /**
+     * @brief Declares that the output port `outPortId` depends on the input
+     * port `inPortId`. Changes to the input only invalidate the dependent
+     * outputs and the successor nodes connected to them. Inputs for which no
+     * dependencies are declared still affect all outputs. Dependencies of
+     * removed ports are removed as well.
+     * @param inPortId Input port
+     * @param outPortId Dependent output port
+     */
+    void addPortDependency(PortId inPortId, PortId outPortId);
+
+    /**
+     * @brief Sets the function for determining the demanded lazy input ports
+     * (see `PortInfo::lazy`). The function may access the data of all
+     * non-lazy input ports. Ports not returned by the function are not
+     * evaluated, thus their data may be invalid or outdated during `eval`.
+     * @param function Function, that returns the demanded input ports
+     */
+    void setInputDemand(InputDemandFunction function);
+
     /**
      * @brief Appends the output port
      * @param port Port data to append
@@ -809,6 +1118,9 @@ private:
     struct Impl;
     std::unique_ptr<Impl> pimpl;
 
+    /// Returns the options for the parallel algorithms of the evaluation
+    exec::ParallelOptions parallelOptions(size_t grainSize) const;
+
     // hide object name setter
     using GtObject::setObjectName;
 };
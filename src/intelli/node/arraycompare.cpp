@@ -0,0 +1,100 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/arraycompare.h"
+
+#include "intelli/data/array.h"
+#include "intelli/private/arraykernels.h"
+
+using namespace intelli;
+
+ArrayCompareNode::ArrayCompareNode() :
+    Node("Array Comparison"),
+    m_operation("operation", tr("Comparison"), tr("Comparison"), CompareOperation::Less)
+{
+    registerProperty(m_operation);
+
+    // in ports
+    m_inA = addInPort({typeId<DoubleArrayData>(), QStringLiteral("a")}, Required);
+    m_inB = addInPort({typeId<DoubleArrayData>(), QStringLiteral("b")}, Required);
+
+    // out ports
+    m_out = addOutPort(PortInfo{
+        typeId<IntArrayData>(),
+        QStringLiteral("mask")
+    });
+
+    connect(&m_operation, &GtAbstractProperty::changed,
+            this, &Node::triggerNodeEvaluation);
+}
+
+ArrayCompareNode::CompareOperation
+ArrayCompareNode::operation() const
+{
+    return m_operation;
+}
+
+void
+ArrayCompareNode::eval()
+{
+    auto dataA = nodeData<DoubleArrayData>(m_inA);
+    auto dataB = nodeData<DoubleArrayData>(m_inB);
+    if (!dataA || !dataB) return evalFailed();
+
+    auto size = kernel::broadcastSize(dataA->size(), dataB->size());
+    if (!size)
+    {
+        gtWarning().verbose().nospace()
+            << __FUNCTION__ << ": "
+            << tr("Array sizes do not match! (%1 and %2)")
+                   .arg(dataA->size()).arg(dataB->size());
+        return evalFailed();
+    }
+
+    View<double> a = dataA->view();
+    View<double> b = dataB->view();
+
+    std::vector<int> result(*size);
+    int* out = result.data();
+
+    // the operation is selected once, such that each kernel is vectorized
+    auto apply = [&](auto op){
+        return parallelFor(*size, [&](size_t begin, size_t end){
+            kernel::binary(a, b, out, begin, end, op);
+        }, kernel::GrainSize);
+    };
+
+    bool success = false;
+    switch (m_operation)
+    {
+    case CompareOperation::LessEqual:
+        success = apply([](double x, double y){ return (int)(x <= y); });
+        break;
+    case CompareOperation::Greater:
+        success = apply([](double x, double y){ return (int)(x > y); });
+        break;
+    case CompareOperation::GreaterEqual:
+        success = apply([](double x, double y){ return (int)(x >= y); });
+        break;
+    case CompareOperation::Equal:
+        success = apply([](double x, double y){ return (int)(x == y); });
+        break;
+    case CompareOperation::NotEqual:
+        success = apply([](double x, double y){ return (int)(x != y); });
+        break;
+    case CompareOperation::Less:
+        success = apply([](double x, double y){ return (int)(x < y); });
+        break;
+    }
+
+    // evaluation was canceled
+    if (!success) return;
+
+    setNodeData(m_out, std::make_shared<IntArrayData>(std::move(result)));
+}
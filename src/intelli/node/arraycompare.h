@@ -0,0 +1,59 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYCOMPARENODE_H
+#define GT_INTELLI_ARRAYCOMPARENODE_H
+
+#include "intelli/node.h"
+
+#include <gt_enumproperty.h>
+
+namespace intelli
+{
+
+/**
+ * @brief The ArrayCompareNode class. Compares two double arrays element-wise
+ * and outputs a mask (int array of ones and zeros). Arrays of size one (e.g.
+ * converted scalars) are broadcasted.
+ */
+class ArrayCompareNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    enum CompareOperation
+    {
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual
+    };
+    Q_ENUM(CompareOperation)
+
+    Q_INVOKABLE ArrayCompareNode();
+
+    CompareOperation operation() const;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    PortId m_inA, m_inB, m_out;
+
+    GtEnumProperty<CompareOperation> m_operation;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYCOMPARENODE_H
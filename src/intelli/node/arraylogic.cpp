@@ -0,0 +1,127 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/arraylogic.h"
+
+#include "intelli/data/array.h"
+#include "intelli/private/arraykernels.h"
+
+using namespace intelli;
+
+ArrayLogicNode::ArrayLogicNode() :
+    Node("Array Logic"),
+    m_operation("operation", tr("Logic Operation"), tr("Logic Operation"), LogicOperation::AND)
+{
+    registerProperty(m_operation);
+
+    // in ports
+    m_inA = addInPort({typeId<IntArrayData>(), QStringLiteral("a")}, Required);
+    m_inB = addInPort({typeId<IntArrayData>(), QStringLiteral("b")}, Required);
+
+    // out ports
+    m_out = addOutPort(PortInfo{
+        typeId<IntArrayData>(),
+        QStringLiteral("mask")
+    });
+
+    connect(&m_operation, &GtAbstractProperty::changed, this, [this](){
+        if (m_operation == LogicOperation::NOT && port(m_inB))
+        {
+            removePort(m_inB);
+        }
+        else if (m_operation != LogicOperation::NOT && !port(m_inB))
+        {
+            addInPort(PortInfo::customId(m_inB, {typeId<IntArrayData>(), QStringLiteral("b")}),
+                      Required);
+        }
+        emit nodeChanged();
+        emit triggerNodeEvaluation();
+    });
+}
+
+ArrayLogicNode::LogicOperation
+ArrayLogicNode::operation() const
+{
+    return m_operation;
+}
+
+void
+ArrayLogicNode::eval()
+{
+    auto dataA = nodeData<IntArrayData>(m_inA);
+    if (!dataA) return evalFailed();
+
+    View<int> a = dataA->view();
+
+    if (m_operation == LogicOperation::NOT)
+    {
+        std::vector<int> result(a.size());
+        int* out = result.data();
+
+        bool success = parallelFor(a.size(), [&](size_t begin, size_t end){
+            kernel::unary(a, out, begin, end, [](int x){ return (int)(x == 0); });
+        }, kernel::GrainSize);
+
+        // evaluation was canceled
+        if (!success) return;
+
+        return setNodeData(m_out, std::make_shared<IntArrayData>(std::move(result)));
+    }
+
+    auto dataB = nodeData<IntArrayData>(m_inB);
+    if (!dataB) return evalFailed();
+
+    auto size = kernel::broadcastSize(dataA->size(), dataB->size());
+    if (!size)
+    {
+        gtWarning().verbose().nospace()
+            << __FUNCTION__ << ": "
+            << tr("Array sizes do not match! (%1 and %2)")
+                   .arg(dataA->size()).arg(dataB->size());
+        return evalFailed();
+    }
+
+    View<int> b = dataB->view();
+
+    std::vector<int> result(*size);
+    int* out = result.data();
+
+    // the operation is selected once, such that each kernel is vectorized
+    auto apply = [&](auto op){
+        return parallelFor(*size, [&](size_t begin, size_t end){
+            kernel::binary(a, b, out, begin, end, op);
+        }, kernel::GrainSize);
+    };
+
+    bool success = false;
+    switch (m_operation)
+    {
+    case LogicOperation::OR:
+        success = apply([](int x, int y){ return (int)((x != 0) | (y != 0)); });
+        break;
+    case LogicOperation::XOR:
+        success = apply([](int x, int y){ return (int)((x != 0) ^ (y != 0)); });
+        break;
+    case LogicOperation::NAND:
+        success = apply([](int x, int y){ return (int)!((x != 0) & (y != 0)); });
+        break;
+    case LogicOperation::NOR:
+        success = apply([](int x, int y){ return (int)!((x != 0) | (y != 0)); });
+        break;
+    case LogicOperation::NOT:
+    case LogicOperation::AND:
+        success = apply([](int x, int y){ return (int)((x != 0) & (y != 0)); });
+        break;
+    }
+
+    // evaluation was canceled
+    if (!success) return;
+
+    setNodeData(m_out, std::make_shared<IntArrayData>(std::move(result)));
+}
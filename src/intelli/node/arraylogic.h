@@ -0,0 +1,59 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYLOGICNODE_H
+#define GT_INTELLI_ARRAYLOGICNODE_H
+
+#include "intelli/node.h"
+
+#include <gt_enumproperty.h>
+
+namespace intelli
+{
+
+/**
+ * @brief The ArrayLogicNode class. Applies a logic operation element-wise to
+ * two masks (int arrays, non-zero values are considered true) and outputs a
+ * mask. Arrays of size one (e.g. converted scalars) are broadcasted.
+ */
+class ArrayLogicNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    enum LogicOperation
+    {
+        NOT,
+        AND,
+        OR,
+        XOR,
+        NAND,
+        NOR,
+    };
+    Q_ENUM(LogicOperation)
+
+    Q_INVOKABLE ArrayLogicNode();
+
+    LogicOperation operation() const;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    PortId m_inA, m_inB, m_out;
+
+    GtEnumProperty<LogicOperation> m_operation;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYLOGICNODE_H
@@ -0,0 +1,105 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/arraymath.h"
+
+#include "intelli/data/array.h"
+#include "intelli/private/arraykernels.h"
+
+#include <cmath>
+
+using namespace intelli;
+
+ArrayMathNode::ArrayMathNode() :
+    Node("Array Math"),
+    m_operation("operation", tr("Math Operation"), tr("Math Operation"), MathOperation::Plus)
+{
+    registerProperty(m_operation);
+
+    // in ports
+    m_inA = addInPort({typeId<DoubleArrayData>(), QStringLiteral("a")}, Required);
+    m_inB = addInPort({typeId<DoubleArrayData>(), QStringLiteral("b")}, Required);
+
+    // out ports
+    m_out = addOutPort(PortInfo{
+        typeId<DoubleArrayData>(),
+        QStringLiteral("result")
+    });
+
+    connect(&m_operation, &GtAbstractProperty::changed,
+            this, &Node::triggerNodeEvaluation);
+}
+
+ArrayMathNode::MathOperation
+ArrayMathNode::operation() const
+{
+    return m_operation;
+}
+
+void
+ArrayMathNode::eval()
+{
+    auto dataA = nodeData<DoubleArrayData>(m_inA);
+    auto dataB = nodeData<DoubleArrayData>(m_inB);
+    if (!dataA || !dataB) return evalFailed();
+
+    auto size = kernel::broadcastSize(dataA->size(), dataB->size());
+    if (!size)
+    {
+        gtWarning().verbose().nospace()
+            << __FUNCTION__ << ": "
+            << tr("Array sizes do not match! (%1 and %2)")
+                   .arg(dataA->size()).arg(dataB->size());
+        return evalFailed();
+    }
+
+    View<double> a = dataA->view();
+    View<double> b = dataB->view();
+
+    std::vector<double> result(*size);
+    double* out = result.data();
+
+    // the operation is selected once, such that each kernel is vectorized
+    auto apply = [&](auto op){
+        return parallelFor(*size, [&](size_t begin, size_t end){
+            kernel::binary(a, b, out, begin, end, op);
+        }, kernel::GrainSize);
+    };
+
+    bool success = false;
+    switch (m_operation)
+    {
+    case MathOperation::Minus:
+        success = apply([](double x, double y){ return x - y; });
+        break;
+    case MathOperation::Multiply:
+        success = apply([](double x, double y){ return x * y; });
+        break;
+    case MathOperation::Divide:
+        success = apply([](double x, double y){ return x / y; });
+        break;
+    case MathOperation::Power:
+        success = apply([](double x, double y){ return std::pow(x, y); });
+        break;
+    case MathOperation::Min:
+        success = apply([](double x, double y){ return y < x ? y : x; });
+        break;
+    case MathOperation::Max:
+        success = apply([](double x, double y){ return x < y ? y : x; });
+        break;
+    case MathOperation::Plus:
+        success = apply([](double x, double y){ return x + y; });
+        break;
+    }
+
+    // evaluation was canceled
+    if (!success) return;
+
+    setNodeData(m_out, std::make_shared<DoubleArrayData>(std::move(result)));
+}
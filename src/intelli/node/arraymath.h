@@ -0,0 +1,60 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYMATHNODE_H
+#define GT_INTELLI_ARRAYMATHNODE_H
+
+#include "intelli/node.h"
+
+#include <gt_enumproperty.h>
+
+namespace intelli
+{
+
+/**
+ * @brief The ArrayMathNode class. Applies a math operation element-wise to two
+ * double arrays. Arrays of size one (e.g. converted scalars) are broadcasted.
+ * Large arrays are processed in parallel.
+ */
+class ArrayMathNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    enum MathOperation
+    {
+        Plus,
+        Minus,
+        Multiply,
+        Divide,
+        Power,
+        Min,
+        Max
+    };
+    Q_ENUM(MathOperation)
+
+    Q_INVOKABLE ArrayMathNode();
+
+    MathOperation operation() const;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    PortId m_inA, m_inB, m_out;
+
+    GtEnumProperty<MathOperation> m_operation;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYMATHNODE_H
@@ -0,0 +1,103 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/arrayreduce.h"
+
+#include "intelli/data/array.h"
+#include "intelli/data/double.h"
+#include "intelli/private/arraykernels.h"
+
+using namespace intelli;
+
+ArrayReduceNode::ArrayReduceNode() :
+    Node("Array Reduction"),
+    m_operation("operation", tr("Reduction"), tr("Reduction"), ReduceOperation::Sum)
+{
+    registerProperty(m_operation);
+
+    // in ports
+    m_in = addInPort({typeId<DoubleArrayData>(), QStringLiteral("array")}, Required);
+
+    // out ports
+    m_out = addOutPort(PortInfo{
+        typeId<DoubleData>(),
+        QStringLiteral("result")
+    });
+
+    connect(&m_operation, &GtAbstractProperty::changed,
+            this, &Node::triggerNodeEvaluation);
+}
+
+ArrayReduceNode::ReduceOperation
+ArrayReduceNode::operation() const
+{
+    return m_operation;
+}
+
+void
+ArrayReduceNode::eval()
+{
+    auto data = nodeData<DoubleArrayData>(m_in);
+    if (!data) return evalFailed();
+
+    View<double> a = data->view();
+    size_t size = a.size();
+
+    if (m_operation == ReduceOperation::Count)
+    {
+        return setNodeData(m_out, std::make_shared<DoubleData>((double)size));
+    }
+
+    if (size == 0)
+    {
+        if (m_operation == ReduceOperation::Sum)
+        {
+            return setNodeData(m_out, std::make_shared<DoubleData>(0.0));
+        }
+
+        gtWarning().verbose().nospace()
+            << __FUNCTION__ << ": "
+            << tr("Cannot reduce an empty array!");
+        return evalFailed();
+    }
+
+    // the operation is selected once, such that each kernel is vectorized
+    auto apply = [&](double init, auto op){
+        return parallelReduce(size, init, [&](size_t begin, size_t end){
+            return kernel::reduce(a, begin, end, init, op);
+        }, op, kernel::GrainSize);
+    };
+
+    auto const sum = [](double x, double y){ return x + y; };
+
+    tl::optional<double> result;
+    switch (m_operation)
+    {
+    case ReduceOperation::Mean:
+        result = apply(0.0, sum).map([size](double value){
+            return value / size;
+        });
+        break;
+    case ReduceOperation::Min:
+        result = apply(a[0], [](double x, double y){ return y < x ? y : x; });
+        break;
+    case ReduceOperation::Max:
+        result = apply(a[0], [](double x, double y){ return y > x ? y : x; });
+        break;
+    case ReduceOperation::Count:
+    case ReduceOperation::Sum:
+        result = apply(0.0, sum);
+        break;
+    }
+
+    // evaluation was canceled
+    if (!result) return;
+
+    setNodeData(m_out, std::make_shared<DoubleData>(*result));
+}
@@ -0,0 +1,56 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYREDUCENODE_H
+#define GT_INTELLI_ARRAYREDUCENODE_H
+
+#include "intelli/node.h"
+
+#include <gt_enumproperty.h>
+
+namespace intelli
+{
+
+/**
+ * @brief The ArrayReduceNode class. Reduces a double array to a single value.
+ */
+class ArrayReduceNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    enum ReduceOperation
+    {
+        Sum,
+        Mean,
+        Min,
+        Max,
+        Count
+    };
+    Q_ENUM(ReduceOperation)
+
+    Q_INVOKABLE ArrayReduceNode();
+
+    ReduceOperation operation() const;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    PortId m_in, m_out;
+
+    GtEnumProperty<ReduceOperation> m_operation;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYREDUCENODE_H
@@ -17,7 +17,14 @@ using namespace intelli;
 FileReaderNode::FileReaderNode() :
     Node("File Reader")
 {
-    setNodeEvalMode(NodeEvalMode::ExclusiveDetached);
+    // file may be read by multiple nodes simultaneously
+    setResources([this]() -> NodeResources {
+        auto const& fileData = nodeData<FileData>(m_inFile);
+        if (!fileData) return {};
+
+        return {{QStringLiteral("file:") + fileData->value().absoluteFilePath(),
+                 ResourceAccess::Shared}};
+    });
 
     m_inFile = addInPort({typeId<FileData>(), tr("file")}, Required);
     m_outData = addOutPort({typeId<ByteArrayData>(), tr("data")});
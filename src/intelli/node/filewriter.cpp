@@ -12,6 +12,7 @@
 #include <intelli/data/bytearray.h>
 #include <intelli/data/file.h>
 #include <intelli/data/bool.h>
+#include <intelli/nodedatapool.h>
 
 #include <gt_finally.h>
 
@@ -20,7 +21,16 @@ using namespace intelli;
 FileWriterNode::FileWriterNode() :
     Node("File Writer")
 {
-    setNodeEvalMode(NodeEvalMode::ExclusiveDetached);
+    setNodeFlag(Sink);
+
+    // file must not be accessed by other nodes while writing
+    setResources([this]() -> NodeResources {
+        auto const& fileData = nodeData<FileData>(m_inFile);
+        if (!fileData) return {};
+
+        return {{QStringLiteral("file:") + fileData->value().absoluteFilePath(),
+                 ResourceAccess::Exclusive}};
+    });
 
     m_inFile = addInPort({typeId<FileData>(), tr("file")}, Required);
     m_inData = addInPort({typeId<ByteArrayData>(), tr("data")}, Required);
@@ -39,7 +49,7 @@ FileWriterNode::eval()
                     << tr("Failed to write file at '%1'!")
                        .arg(fileData ? fileData->value().filePath() : "");
         }
-        setNodeData(m_outSuccess, std::make_shared<BoolData>(success));
+        setNodeData(m_outSuccess, makeNodeData<BoolData>(success));
     });
 
     auto const& fileData = nodeData<FileData>(m_inFile);
@@ -15,6 +15,7 @@
 #include <intelli/data/string.h>
 #include <intelli/data/integer.h>
 #include <intelli/nodedatainterface.h>
+#include <intelli/nodedatapool.h>
 
 #include "gt_algorithms.h"
 #include "gt_coreapplication.h"
@@ -295,16 +296,41 @@ GenericCalculatorExecNode::GenericCalculatorExecNode() :
     Node(tr("Execute Calculator")),
     m_className("targetClassName",
                 tr("Target class name"),
-                tr("Target class name of calculator"))
+                tr("Target class name of calculator")),
+    m_isolated("isolated",
+               tr("Isolated"),
+               tr("Evaluates the calculator in a separate process. Allows "
+                  "calculators that are not thread-safe to be evaluated in "
+                  "parallel."),
+               false),
+    m_cacheResults("cacheResults",
+                   tr("Cache Results"),
+                   tr("Loads the results of the calculator from the node "
+                      "result cache, if its inputs and properties did not "
+                      "change. Should only be enabled for calculators without "
+                      "side effects."),
+                   false)
 {
     static auto init = Impl::init();
     Q_UNUSED(init);
 
     setNodeFlag(Resizable);
+    // calculators have side effects, thus they must be evaluated even if their
+    // outputs are not connected to another sink
+    setNodeFlag(Sink);
     m_outSuccess = addOutPort(PortInfo{typeId<BoolData>(), tr("success")});
 
+    // the number of concurrent instances of a calculator can be limited using
+    // `exec::setResourceCapacity`
+    setResources([this]() -> NodeResources {
+        return {{QStringLiteral("calculator:") + m_className.get(),
+                 ResourceAccess::Shared}};
+    });
+
     registerProperty(m_className);
     m_className.setReadOnly(true);
+    registerProperty(m_isolated);
+    registerProperty(m_cacheResults);
 
     connect(this, &Node::portConnected, this,
             &GenericCalculatorExecNode::onPortConnected);
@@ -316,6 +342,14 @@ GenericCalculatorExecNode::GenericCalculatorExecNode() :
             this, &GenericCalculatorExecNode::updateCurrentObject);
     connect(&m_className, &GtAbstractProperty::changed,
             this, [this]() { emit classNameChanged(m_className.get()); });
+
+    connect(&m_isolated, &GtAbstractProperty::changed, this, [this](){
+        setNodeEvalMode(m_isolated.get() ? NodeEvalMode::Isolated :
+                                           NodeEvalMode::Default);
+    });
+    connect(&m_cacheResults, &GtAbstractProperty::changed, this, [this](){
+        setNodeFlag(NodeFlag::Cacheable, m_cacheResults.get());
+    });
 }
 
 QString
@@ -371,7 +405,7 @@ GenericCalculatorExecNode::eval()
 
     // set output data depending on success
     auto finally = gt::finally([&success, this](){
-        setNodeData(m_outSuccess, std::make_shared<BoolData>(success));
+        setNodeData(m_outSuccess, makeNodeData<BoolData>(success));
     });
 
     auto obj = currentObject();
@@ -12,6 +12,7 @@
 
 #include <intelli/node.h>
 #include "gt_stringproperty.h"
+#include "gt_boolproperty.h"
 
 class GtPropertyTreeView;
 
@@ -79,6 +80,10 @@ private:
     PortId m_outSuccess;
     /// property to define the class name
     GtStringProperty m_className;
+    /// property to evaluate the calculator in a separate process
+    GtBoolProperty m_isolated;
+    /// property to load the results of the calculator from the result cache
+    GtBoolProperty m_cacheResults;
     /// dynamic input ports for the properties of the calculator
     QHash<PortId, QString> m_calcInPorts;
     /// dynamic output ports for the output data of the calculator
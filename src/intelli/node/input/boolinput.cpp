@@ -9,6 +9,7 @@
 
 #include <intelli/node/input/boolinput.h>
 #include <intelli/data/bool.h>
+#include <intelli/nodedatapool.h>
 
 using namespace intelli;
 
@@ -46,5 +47,5 @@ BoolInputNode::setValue(bool value)
 void
 BoolInputNode::eval()
 {
-    setNodeData(m_out, std::make_shared<BoolData>(value()));
+    setNodeData(m_out, makeNodeData<BoolData>(value()));
 }
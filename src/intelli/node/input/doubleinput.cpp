@@ -9,6 +9,7 @@
 
 #include <intelli/node/input/doubleinput.h>
 #include <intelli/data/double.h>
+#include <intelli/nodedatapool.h>
 
 #include <intelli/gui/widgets/doubleinputwidget.h>
 #include <intelli/node/input/numberinputnode_utils.h>
@@ -115,5 +116,5 @@ DoubleInputNode::setInputModeValue(int value)
 void
 DoubleInputNode::eval()
 {
-    setNodeData(m_out, std::make_shared<DoubleData>(value()));
+    setNodeData(m_out, makeNodeData<DoubleData>(value()));
 }
@@ -13,6 +13,7 @@
 #include "intelli/data/int.h"
 #include "intelli/data/double.h"
 #include "intelli/data/string.h"
+#include "intelli/nodedatapool.h"
 
 #include <gt_utilities.h>
 
@@ -45,13 +46,13 @@ NodeDataPtr variantToNodeData(QVariant value)
     switch(value.type())
     {
     case QVariant::Bool:
-        return std::make_shared<BoolData>(value.toBool());
+        return makeNodeData<BoolData>(value.toBool());
     case QVariant::Int:
-        return std::make_shared<IntData>(value.toInt());
+        return makeNodeData<IntData>(value.toInt());
     case QVariant::Double:
-        return std::make_shared<DoubleData>(value.toDouble());
+        return makeNodeData<DoubleData>(value.toDouble());
     case QVariant::String:
-        return std::make_shared<StringData>(value.toString());
+        return makeNodeData<StringData>(value.toString());
     default:
         return {};
     }
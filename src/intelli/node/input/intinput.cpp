@@ -9,6 +9,7 @@
 
 #include <intelli/node/input/intinput.h>
 #include <intelli/data/int.h>
+#include <intelli/nodedatapool.h>
 
 #include <intelli/gui/widgets/intinputwidget.h>
 #include <intelli/node/input/numberinputnode_utils.h>
@@ -115,5 +116,5 @@ IntInputNode::setInputModeValue(int value)
 void
 IntInputNode::eval()
 {
-    setNodeData(m_out, std::make_shared<IntData>(value()));
+    setNodeData(m_out, makeNodeData<IntData>(value()));
 }
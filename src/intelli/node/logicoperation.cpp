@@ -10,6 +10,7 @@
 #include "intelli/node/logicoperation.h"
 
 #include <intelli/data/bool.h>
+#include <intelli/nodedatapool.h>
 
 #include <QComboBox>
 #include <QLayout>
@@ -78,7 +79,7 @@ LogicNode::eval()
         c = !(a | b); break;
     }
 
-    setNodeData(m_out, std::make_shared<BoolData>(c));
+    setNodeData(m_out, makeNodeData<BoolData>(c));
 }
 
 QString
@@ -0,0 +1,413 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/map.h"
+
+#include "intelli/graph.h"
+#include "intelli/data/list.h"
+#include "intelli/node/groupinputprovider.h"
+#include "intelli/node/groupoutputprovider.h"
+#include "intelli/exec/dummynodedatamodel.h"
+#include "intelli/private/utils.h"
+
+#include <gt_algorithms.h>
+#include <gt_objectfactory.h>
+#include <gt_objectmemento.h>
+#include <gt_qtutilities.h>
+
+#include <QThread>
+
+#include <atomic>
+
+using namespace intelli;
+
+struct MapNode::Impl
+{
+    /// Source index denoting the element
+    static constexpr size_t ElementSource = std::numeric_limits<size_t>::max();
+
+    /// Input of a node within the compiled body
+    struct Input
+    {
+        /// input port of the node
+        PortId inPort;
+        /// index of the source node or `ElementSource`
+        size_t source = ElementSource;
+        /// output port of the source node
+        PortId outPort;
+    };
+
+    /// Node within the compiled body
+    struct Step
+    {
+        /// memento used to instantiate the node
+        GtObjectMemento memento;
+        /// inputs of the node
+        std::vector<Input> inputs;
+    };
+
+    /// Compiled structure of the body, shared by all workers
+    struct Plan
+    {
+        /// nodes the result depends on in topological order
+        std::vector<Step> steps;
+        /// source of the result
+        Input result;
+        /// user variables to access during evaluation
+        GraphUserVariables const* userVariables = nullptr;
+        /// scope to access during evaluation
+        GtObject* scope = nullptr;
+    };
+
+    /// Instance of the body, that is only used by a single worker
+    struct Instance
+    {
+        explicit Instance(Plan const& _plan) :
+            plan(_plan)
+        {
+            nodes.reserve(plan.steps.size());
+            for (Step const& step : plan.steps)
+            {
+                auto node = gt::unique_qobject_cast<Node>(
+                    step.memento.toObject(*gtObjectFactory)
+                );
+                if (!node) return;
+
+                nodes.push_back(std::move(node));
+            }
+        }
+
+        bool isValid() const { return nodes.size() == plan.steps.size(); }
+
+        /**
+         * @brief Evaluates the body for the given element
+         * @param element Element to pass to the body
+         * @param result Result of the body
+         * @return success
+         */
+        bool evaluate(NodeDataPtr const& element, NodeDataPtr& result)
+        {
+            assert(isValid());
+
+            std::vector<NodeDataPtrList> outputs(plan.steps.size());
+
+            auto const findData = [&](Input const& input) -> NodeDataPtr {
+                if (input.source == ElementSource) return element;
+
+                for (auto const& data : outputs[input.source])
+                {
+                    if (data.first == input.outPort) return data.second;
+                }
+                return nullptr;
+            };
+
+            for (size_t idx = 0; idx < plan.steps.size(); ++idx)
+            {
+                Node& node = *nodes[idx];
+
+                DummyNodeDataModel model{node};
+                model.setUserVariables(plan.userVariables);
+                model.setScope(plan.scope);
+
+                for (Input const& input : plan.steps[idx].inputs)
+                {
+                    model.setNodeData(input.inPort, findData(input));
+                }
+
+                for (PortInfo const& port : node.ports(PortType::In))
+                {
+                    if (!port.optional &&
+                        !model.nodeData(node.uuid(), port.id()).ptr)
+                    {
+                        gtWarning() << utils::logId<MapNode>()
+                                    << tr("Missing required input data of node '%1'!")
+                                           .arg(node.caption());
+                        return false;
+                    }
+                }
+
+                NodeEvalMode evalMode = node.nodeEvalMode();
+                if (evalMode == NodeEvalMode::ForwardInputsToOutputs)
+                {
+                    auto const& inData = model.nodeData(PortType::In);
+                    auto const& outPorts = node.ports(PortType::Out);
+                    for (size_t i = 0; i < std::min(inData.size(), outPorts.size()); ++i)
+                    {
+                        model.setNodeData(outPorts[i].id(), inData[i].second);
+                    }
+                }
+                else if (evalMode != NodeEvalMode::NoEvaluationRequired)
+                {
+                    exec::blockingEvaluation(node, &model);
+                }
+
+                if (!model.evaluationSuccessful()) return false;
+
+                outputs[idx] = model.nodeData(PortType::Out);
+            }
+
+            result = findData(plan.result);
+            return true;
+        }
+
+        Plan const& plan;
+        std::vector<std::unique_ptr<Node>> nodes;
+    };
+
+    /**
+     * @brief Compiles the structure of the body, i.e. finds and sorts all nodes
+     * the result depends on.
+     * @param node Map node
+     * @param body Body graph
+     * @param plan Plan to populate
+     * @return success
+     */
+    static bool
+    compile(MapNode const& node, Graph& body, Plan& plan)
+    {
+        auto* input = body.inputProvider();
+        auto* output = body.outputProvider();
+        if (!input || !output ||
+            input->ports(PortType::Out).empty() ||
+            output->ports(PortType::In).empty())
+        {
+            gtError() << utils::logId(node)
+                      << tr("The body requires at least one input and one output port!");
+            return false;
+        }
+
+        PortId elementPort = input->ports(PortType::Out).front().id();
+        PortId resultPort  = output->ports(PortType::In).front().id();
+
+        QVector<ConnectionId> const& connections = body.connectionIds();
+
+        // find all nodes the result depends on
+        QVector<NodeId> dependencies;
+        QVector<NodeId> pending{output->id()};
+        while (!pending.isEmpty())
+        {
+            NodeId nodeId = pending.takeLast();
+            for (ConnectionId const& conId : connections)
+            {
+                if (conId.inNodeId != nodeId) continue;
+
+                NodeId source = conId.outNodeId;
+                if (source == input->id() || dependencies.contains(source)) continue;
+
+                dependencies.push_back(source);
+                pending.push_back(source);
+            }
+        }
+
+        // sort dependencies, such that predecessors are evaluated first
+        std::map<NodeId, std::vector<NodeId>> adjacencyMatrix;
+        for (NodeId nodeId : qAsConst(dependencies))
+        {
+            std::vector<NodeId> successors;
+            for (ConnectionId const& conId : connections)
+            {
+                if (conId.outNodeId == nodeId &&
+                    dependencies.contains(conId.inNodeId))
+                {
+                    successors.push_back(conId.inNodeId);
+                }
+            }
+            adjacencyMatrix.insert({nodeId, successors});
+        }
+        std::vector<NodeId> order = gt::topo_sort(adjacencyMatrix);
+
+        std::map<NodeId, size_t> indices;
+        for (NodeId nodeId : order)
+        {
+            Node* dependency = body.findNode(nodeId);
+            assert(dependency);
+
+            if (qobject_cast<Graph*>(dependency))
+            {
+                gtError() << utils::logId(node)
+                          << tr("Subgraphs within the body are not supported!");
+                return false;
+            }
+
+            indices.insert({nodeId, plan.steps.size()});
+            plan.steps.push_back({dependency->toMemento(), {}});
+        }
+
+        bool hasResult = false;
+        for (ConnectionId const& conId : connections)
+        {
+            bool isResult = conId.inNodeId == output->id() &&
+                            conId.inPort == resultPort;
+
+            auto target = indices.find(conId.inNodeId);
+            if (target == indices.end() && !isResult) continue;
+
+            Input in{conId.inPort, ElementSource, conId.outPort};
+            if (conId.outNodeId == input->id())
+            {
+                // only the element is passed to the body
+                if (conId.outPort != elementPort) continue;
+            }
+            else
+            {
+                auto source = indices.find(conId.outNodeId);
+                if (source == indices.end()) continue;
+                in.source = source->second;
+            }
+
+            if (isResult)
+            {
+                plan.result = in;
+                hasResult = true;
+                continue;
+            }
+            plan.steps[target->second].inputs.push_back(in);
+        }
+
+        if (!hasResult)
+        {
+            gtError() << utils::logId(node)
+                      << tr("The output port of the body is not connected!");
+            return false;
+        }
+
+        return true;
+    }
+};
+
+MapNode::MapNode() :
+    Node(tr("Map")),
+    m_maxConcurrency("maxConcurrency",
+                     tr("Max. Concurrency"),
+                     tr("Max. number of elements evaluated in parallel "
+                        "(0 = number of cores)"),
+                     0)
+{
+    registerProperty(m_maxConcurrency);
+
+    auto* graph = new Graph;
+    graph->setCaption(tr("Body"));
+    graph->setDefault(true);
+    appendChild(graph);
+
+    m_in  = addInPort(makePort(typeId<ListData>())
+                          .setCaption(tr("list")),
+                      Required);
+    m_out = addOutPort(makePort(typeId<ListData>())
+                           .setCaption(tr("list")));
+
+    connect(&m_maxConcurrency, &GtAbstractProperty::changed,
+            this, &Node::triggerNodeEvaluation);
+}
+
+MapNode::~MapNode() = default;
+
+Graph*
+MapNode::body()
+{
+    return findDirectChild<Graph*>();
+}
+
+Graph const*
+MapNode::body() const
+{
+    return const_cast<MapNode*>(this)->body();
+}
+
+void
+MapNode::setMaxConcurrency(int count)
+{
+    m_maxConcurrency = std::max(0, count);
+}
+
+int
+MapNode::maxConcurrency() const
+{
+    return m_maxConcurrency.get();
+}
+
+void
+MapNode::nodeEvent(NodeEvent const* e)
+{
+    if (e->type() == NodeEventType::DataInterfaceAvailableEvent)
+    {
+        if (Graph* graph = body()) graph->initInputOutputProviders();
+    }
+}
+
+void
+MapNode::eval()
+{
+    auto list = nodeData<ListData>(m_in);
+    Graph* graph = body();
+    if (!list || !graph)
+    {
+        setNodeData(m_out, nullptr);
+        return evalFailed();
+    }
+
+    Impl::Plan plan;
+    if (auto* model = exec::nodeDataInterface(*this))
+    {
+        plan.userVariables = model->userVariables();
+        plan.scope = model->scope();
+    }
+
+    if (!Impl::compile(*this, *graph, plan))
+    {
+        setNodeData(m_out, nullptr);
+        return evalFailed();
+    }
+
+    size_t size = list->size();
+    std::vector<NodeDataPtr> results(size);
+
+    int maxCount = maxConcurrency() > 0 ? maxConcurrency() :
+                                          QThread::idealThreadCount();
+    size_t concurrency = std::min(size, (size_t)std::max(1, maxCount));
+
+    // the elements are split into one chunk per thread, thus the body is
+    // instantiated once per chunk and at most `concurrency` elements are
+    // evaluated at once
+    size_t grainSize = concurrency > 0 ? (size + concurrency - 1) / concurrency : 1;
+
+    std::atomic<bool> success{true};
+
+    bool finished = parallelFor(size, [this, &plan, &list, &results, &success]
+                                (size_t begin, size_t end){
+        Impl::Instance instance{plan};
+        if (!instance.isValid())
+        {
+            success = false;
+            return;
+        }
+
+        for (size_t idx = begin; success && idx < end; ++idx)
+        {
+            if (isEvaluationCanceled())
+            {
+                success = false;
+                return;
+            }
+
+            if (!instance.evaluate(list->at(idx), results[idx]))
+            {
+                success = false;
+            }
+        }
+    }, grainSize);
+
+    if (!finished || !success)
+    {
+        setNodeData(m_out, nullptr);
+        return evalFailed();
+    }
+
+    setNodeData(m_out, std::make_shared<ListData>(std::move(results)));
+}
@@ -0,0 +1,76 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_MAPNODE_H
+#define GT_INTELLI_MAPNODE_H
+
+#include <intelli/node.h>
+
+#include <gt_intproperty.h>
+
+namespace intelli
+{
+
+class Graph;
+
+/**
+ * @brief Evaluates the embedded graph (body) once per element of the input
+ * list and gathers the results into the output list. The element is passed to
+ * the first input port of the body, the result is taken from the first output
+ * port of the body. Elements are evaluated in parallel on isolated data models,
+ * the structure of the body is only compiled once per evaluation.
+ */
+class GT_INTELLI_EXPORT MapNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE MapNode();
+    ~MapNode();
+
+    /**
+     * @brief Returns the graph, that is evaluated for each element
+     * @return Body graph
+     */
+    Graph* body();
+    Graph const* body() const;
+
+    /**
+     * @brief Sets the max. number of elements evaluated in parallel.
+     * @param count Max. number of elements (0 = number of cores)
+     */
+    void setMaxConcurrency(int count);
+
+    /**
+     * @brief Returns the max. number of elements evaluated in parallel.
+     * @return Max. number of elements (0 = number of cores)
+     */
+    int maxConcurrency() const;
+
+protected:
+
+    void nodeEvent(NodeEvent const* event) override;
+
+    void eval() override;
+
+private:
+
+    /// Helper struct to hide implementation details
+    struct Impl;
+
+    /// max. number of elements evaluated in parallel
+    GtIntProperty m_maxConcurrency;
+
+    PortId m_in, m_out;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_MAPNODE_H
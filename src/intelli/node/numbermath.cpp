@@ -10,6 +10,7 @@
 #include "intelli/node/numbermath.h"
 
 #include "intelli/data/double.h"
+#include "intelli/nodedatapool.h"
 
 #include <QMetaType>
 
@@ -108,7 +109,7 @@ NumberMathNode::eval()
         break;
     }
 
-    setNodeData(m_out, std::make_shared<DoubleData>(c));
+    setNodeData(m_out, makeNodeData<DoubleData>(c));
 }
 
 QString
@@ -14,6 +14,8 @@
 #include "gt_application.h"
 #include "gt_datamodel.h"
 #include "gt_project.h"
+#include "gt_objectmemento.h"
+#include "gt_objectmementodiff.h"
 
 using namespace intelli;
 
@@ -21,14 +23,22 @@ ObjectSink::ObjectSink() :
     Node("Object sink"),
     m_in(addInPort({typeId<ObjectData>(), tr("Object")})),
     m_target("target", tr("Target"), tr("Target"), QString{},
-             this, QStringList{ GT_CLASSNAME(GtObject) }, true)
+             this, QStringList{ GT_CLASSNAME(GtObject) }, true),
+    m_exportMode("exportMode", tr("Export Mode"),
+                 tr("Merge: Applies only the differences to the target "
+                    "(fast, undo is scoped to the target).\n"
+                    "Replace: Replaces the target with a copy of the source."),
+                 ExportMode::Merge)
 {
     registerProperty(m_target);
+    registerProperty(m_exportMode);
 
     setNodeEvalMode(NodeEvalMode::Blocking);
+    setNodeFlag(Sink);
 
     auto const updateExportEnabled = [this]() {
-        bool enabled = nodeData<ObjectData>(m_in) != nullptr;
+        auto data = nodeData<ObjectData>(m_in);
+        bool enabled = data && data->object();
         if (m_canExport == enabled) return;
         m_canExport = enabled;
         emit exportEnabledChanged(enabled);
@@ -60,7 +70,7 @@ ObjectSink::doExport()
 {
     auto data = nodeData<ObjectData>(m_in);
 
-    if (!data) return;
+    if (!data || !data->object()) return;
 
     const GtObject* source = data->object();
 
@@ -86,23 +96,61 @@ ObjectSink::doExport()
         gtDataModel->appendChild(sourceClone, target);
         return;
     }
-    else
+
+    switch (m_exportMode.getVal())
     {
-        GtObject* sourceClone = source->clone();
-        GtObject* targetParent = target->parentObject();
-        QString oldUUID = target->uuid();
-        QString oldName = target->objectName();
-        sourceClone->moveToThread(targetParent->thread());
+    case ExportMode::Merge:
+        return mergeInto(*source, *target);
+    case ExportMode::Replace:
+        return replace(*source, *target);
+    }
+}
+
+void
+ObjectSink::mergeInto(GtObject const& source, GtObject& target)
+{
+    // the target must retain its identity
+    std::unique_ptr<GtObject> sourceClone{source.clone()};
+    if (!sourceClone)
+    {
+        gtError() << tr("Failed to export object '%1'!").arg(source.objectName());
+        return;
+    }
 
-        GtCommand command = gtApp->startCommand(gtApp->currentProject(),
-                                                tr("Overwrite target"));
-        sourceClone->setUuid(oldUUID);
-        sourceClone->setObjectName(oldName);
-        delete target;
-        targetParent->appendChild(sourceClone);
+    sourceClone->setUuid(target.uuid());
+    sourceClone->setObjectName(target.objectName());
 
-        gtApp->endCommand(command);
+    GtObjectMementoDiff diff{target.toMemento(), sourceClone->toMemento()};
 
-        return;
+    // nothing to do
+    if (diff.isNull()) return;
+
+    auto cmd = gtApp->makeCommand(&target, tr("Overwrite target '%1'")
+                                               .arg(target.objectName()));
+    Q_UNUSED(cmd);
+
+    if (!target.applyDiff(diff))
+    {
+        gtError() << tr("Failed to merge object '%1' into target '%2'!")
+                         .arg(source.objectName(), target.objectName());
     }
 }
+
+void
+ObjectSink::replace(GtObject const& source, GtObject& target)
+{
+    GtObject* sourceClone = source.clone();
+    GtObject* targetParent = target.parentObject();
+    QString oldUUID = target.uuid();
+    QString oldName = target.objectName();
+    sourceClone->moveToThread(targetParent->thread());
+
+    GtCommand command = gtApp->startCommand(gtApp->currentProject(),
+                                            tr("Overwrite target"));
+    sourceClone->setUuid(oldUUID);
+    sourceClone->setObjectName(oldName);
+    delete &target;
+    targetParent->appendChild(sourceClone);
+
+    gtApp->endCommand(command);
+}
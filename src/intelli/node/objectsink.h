@@ -11,6 +11,7 @@
 #define GT_INTELLI_OBJECTSINK_H
 
 #include "gt_objectlinkproperty.h"
+#include "gt_enumproperty.h"
 #include "intelli/node.h"
 
 class QPushButton;
@@ -18,11 +19,25 @@ class QPushButton;
 namespace intelli
 {
 
-class ObjectSink : public Node
+class GT_INTELLI_TEST_EXPORT ObjectSink : public Node
 {
     Q_OBJECT
 
 public:
+
+    /// Denotes how the source is exported if source and target are of
+    /// the same class
+    enum class ExportMode
+    {
+        /// Computes the difference between source and target and applies it
+        /// to the target in place. The undo command is scoped to the target.
+        Merge,
+        /// Replaces the target with a clone of the source. The undo command
+        /// is scoped to the entire project.
+        Replace
+    };
+    Q_ENUM(ExportMode);
+
     Q_INVOKABLE ObjectSink();
 
     bool canExport() const;
@@ -37,8 +52,24 @@ private:
     PortId m_in;
 
     GtObjectLinkProperty m_target;
+    GtEnumProperty<ExportMode> m_exportMode;
     bool m_canExport{false};
 
+    /**
+     * @brief Overwrites the target with the source by applying the difference
+     * of both objects to the target.
+     * @param source Source object
+     * @param target Target object, must be of the same class as the source
+     */
+    void mergeInto(GtObject const& source, GtObject& target);
+
+    /**
+     * @brief Overwrites the target by replacing it with a clone of the source.
+     * @param source Source object
+     * @param target Target object, must be of the same class as the source
+     */
+    void replace(GtObject const& source, GtObject& target);
+
 private slots:
     void doExport();
 };
@@ -53,6 +53,9 @@ SleepyNode::eval()
     {
         GtEventLoop eventloop(intervalMs);
         eventloop.exec();
+
+        if (isEvaluationCanceled()) return;
+
         gtTrace().verbose()
             << gt::quoted(caption(), "", ":")
             << "Sending update" << i << "of" << updates;
@@ -10,6 +10,7 @@
 #include <intelli/node/stringbuilder.h>
 
 #include <intelli/data/string.h>
+#include <intelli/nodedatapool.h>
 
 using namespace intelli;
 
@@ -59,5 +60,5 @@ StringBuilderNode::eval()
     if (result.contains("%1")) result = result.arg(a);
     if (result.contains("%2")) result = result.arg(b);
 
-    setNodeData(m_out, std::make_shared<StringData>(std::move(result)));
+    setNodeData(m_out, makeNodeData<StringData>(std::move(result)));
 }
@@ -0,0 +1,87 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/node/switch.h"
+
+#include "intelli/data/bool.h"
+#include "intelli/data/double.h"
+#include "intelli/nodedatafactory.h"
+
+using namespace intelli;
+
+SwitchNode::SwitchNode() :
+    Node(tr("Switch")),
+    m_dataType("dataType", tr("Data Type"), tr("Type of the forwarded data"),
+               NodeDataFactory::instance().validTypeIds(),
+               typeId<DoubleData>())
+{
+    registerProperty(m_dataType);
+
+    m_inCondition = addInPort(makePort(typeId<BoolData>())
+                                  .setCaption(tr("condition")),
+                              Required);
+    m_inTrue = addInPort(makePort(m_dataType.selectedValue())
+                             .setCaption(tr("true"))
+                             .setLazy(true));
+    m_inFalse = addInPort(makePort(m_dataType.selectedValue())
+                              .setCaption(tr("false"))
+                              .setLazy(true));
+    m_out = addOutPort(makePort(m_dataType.selectedValue())
+                           .setCaptionVisible(false));
+
+    // only the selected branch is evaluated
+    setInputDemand([this]() -> std::vector<PortId> {
+        PortId portId = selectedInput();
+        if (!portId.isValid()) return {};
+        return { portId };
+    });
+
+    connect(&m_dataType, &GtAbstractProperty::changed,
+            this, &SwitchNode::updatePortTypes);
+}
+
+PortId
+SwitchNode::selectedInput() const
+{
+    auto condition = nodeData<BoolData>(m_inCondition);
+    if (!condition) return PortId{};
+
+    return condition->value() ? m_inTrue : m_inFalse;
+}
+
+void
+SwitchNode::updatePortTypes()
+{
+    TypeId const& dataType = m_dataType.selectedValue();
+
+    for (PortId portId : {m_inTrue, m_inFalse, m_out})
+    {
+        PortInfo* port = this->port(portId);
+        assert(port);
+        if (port->typeId == dataType) continue;
+
+        port->typeId = dataType;
+        emit portChanged(portId);
+    }
+
+    emit triggerNodeEvaluation();
+}
+
+void
+SwitchNode::eval()
+{
+    PortId portId = selectedInput();
+    if (!portId.isValid())
+    {
+        setNodeData(m_out, nullptr);
+        return evalFailed();
+    }
+
+    setNodeData(m_out, nodeData(portId));
+}
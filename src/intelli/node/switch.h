@@ -0,0 +1,52 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_SWITCHNODE_H
+#define GT_INTELLI_SWITCHNODE_H
+
+#include <intelli/node.h>
+#include <intelli/property/stringselection.h>
+
+namespace intelli
+{
+
+/**
+ * @brief Forwards either the `true` or the `false` input depending on the
+ * condition. Both inputs are evaluated lazily, thus only the selected branch
+ * is evaluated.
+ */
+class GT_INTELLI_EXPORT SwitchNode : public Node
+{
+    Q_OBJECT
+
+public:
+
+    Q_INVOKABLE SwitchNode();
+
+protected:
+
+    void eval() override;
+
+private:
+
+    /// type id of the forwarded data
+    StringSelectionProperty m_dataType;
+
+    PortId m_inCondition, m_inTrue, m_inFalse, m_out;
+
+    /// Returns the input port selected by the condition
+    PortId selectedInput() const;
+
+    /// Updates the type ids of the ports once the data type changed
+    void updatePortTypes();
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_SWITCHNODE_H
@@ -9,6 +9,8 @@
 
 #include "intelli/nodedata.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 QString const&
@@ -28,3 +30,41 @@ NodeData::NodeData(QString typeName) :
 {
 
 }
+
+bool
+NodeData::isEqualTo(NodeData const& other) const
+{
+    Q_UNUSED(other);
+    return false;
+}
+
+bool
+NodeData::serialize(QDataStream& stream) const
+{
+    Q_UNUSED(stream);
+    return false;
+}
+
+bool
+NodeData::deserialize(QDataStream& stream)
+{
+    Q_UNUSED(stream);
+    return false;
+}
+
+size_t
+NodeData::byteSize() const
+{
+    return 0;
+}
+
+bool
+intelli::isEqual(std::shared_ptr<NodeData const> const& a,
+                 std::shared_ptr<NodeData const> const& b)
+{
+    if (a == b) return true;
+    if (!a || !b) return false;
+    if (a->metaObject() != b->metaObject()) return false;
+
+    return a->isEqualTo(*b);
+}
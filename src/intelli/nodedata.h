@@ -18,6 +18,8 @@
 
 #include <QMetaMethod>
 
+class QDataStream;
+
 namespace intelli
 {
 
@@ -103,6 +105,43 @@ public:
         return {var};
     }
 
+    /**
+     * @brief Returns whether the data of `other` is equal to the data of this
+     * object. `other` is guaranteed to be of the same type. Used by the
+     * execution model to skip the reevaluation of nodes whose inputs did not
+     * change (early cutoff). The default implementation considers the data to
+     * be unequal. Should only be implemented for data that is cheap to compare.
+     * @param other Other node data of the same type
+     * @return Is equal
+     */
+    virtual bool isEqualTo(NodeData const& other) const;
+
+    /**
+     * @brief Writes the data to `stream`, such that it can be restored using
+     * `deserialize`. Used to transfer the data to another process. The default
+     * implementation does not support serialization.
+     * @param stream Stream to write to
+     * @return success
+     */
+    virtual bool serialize(QDataStream& stream) const;
+
+    /**
+     * @brief Restores the data from `stream` (see `serialize`). Should only be
+     * called on newly created objects, as node data is immutable once shared.
+     * @param stream Stream to read from
+     * @return success
+     */
+    virtual bool deserialize(QDataStream& stream);
+
+    /**
+     * @brief Returns the approximate number of bytes occupied by the data.
+     * Used by the execution model to determine which data to spill to disk
+     * once its memory budget is exceeded. The default implementation returns
+     * zero, i.e. the data is never spilled.
+     * @return Size in bytes
+     */
+    virtual size_t byteSize() const;
+
 protected:
 
     /**
@@ -116,6 +155,16 @@ private:
     QString m_typeName;
 };
 
+/**
+ * @brief Returns whether both node data objects are equal. Null objects are
+ * equal to each other. Objects of different types are never equal.
+ * @param a Node data a
+ * @param b Node data b
+ * @return Is equal
+ */
+GT_INTELLI_EXPORT bool isEqual(std::shared_ptr<NodeData const> const& a,
+                               std::shared_ptr<NodeData const> const& b);
+
 /**
  * @brief Returns the typeid of a node data class
  * @return Typeid
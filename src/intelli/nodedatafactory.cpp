@@ -14,6 +14,8 @@
 #include "gt_qtutilities.h"
 #include "gt_logging.h"
 
+#include <QDataStream>
+
 using namespace intelli;
 
 namespace
@@ -193,3 +195,41 @@ NodeDataFactory::makeData(TypeId const& typeId) const noexcept
     return gt::unique_qobject_cast<NodeData>(std::move(obj));
 }
 
+bool
+NodeDataFactory::serialize(NodeDataPtr const& data, QDataStream& stream) const
+{
+    // null data is denoted by an empty type id
+    stream << (data ? data->typeId() : TypeId{});
+    if (!data) return stream.status() == QDataStream::Ok;
+
+    if (!data->serialize(stream))
+    {
+        gtWarning() << QObject::tr("Failed to serialize node data of type '%1'!")
+                           .arg(data->typeId());
+        return false;
+    }
+    return true;
+}
+
+tl::optional<NodeDataPtr>
+NodeDataFactory::deserialize(QDataStream& stream) const
+{
+    TypeId typeId;
+    stream >> typeId;
+    if (stream.status() != QDataStream::Ok) return {};
+
+    if (typeId.isEmpty()) return NodeDataPtr{};
+
+    std::unique_ptr<GtObject> obj{
+        const_cast<NodeDataFactory*>(this)->newObject(typeId)
+    };
+    auto data = gt::unique_qobject_cast<NodeData>(std::move(obj));
+
+    if (!data || !data->deserialize(stream))
+    {
+        gtWarning() << QObject::tr("Failed to deserialize node data of type '%1'!")
+                           .arg(typeId);
+        return {};
+    }
+    return NodeDataPtr{std::move(data)};
+}
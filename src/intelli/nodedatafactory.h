@@ -13,9 +13,15 @@
 #include <intelli/exports.h>
 #include <intelli/globals.h>
 
+#include <intelli/nodedatapool.h>
+
 #include <gt_abstractobjectfactory.h>
 #include <gt_object.h>
 
+#include <tl/optional.hpp>
+
+class QDataStream;
+
 /// Helper macro for registering a node class. The node class does should not be
 /// registered additionally as a "data" object of your module
 #define GT_INTELLI_REGISTER_DATA(CLASS) \
@@ -35,7 +41,7 @@
 /// Helper macro to register a simple conversion between two types
 #define GT_INTELLI_REGISTER_INLINE_CONVERSION(FROM, TO, HOW) \
     GT_INTELLI_REGISTER_CONVERSION(FROM, TO, [](auto const& data){ \
-        return std::make_shared<TO const>(HOW); });
+        return intelli::makeNodeData<TO>(HOW); });
 
 namespace intelli
 {
@@ -146,6 +152,26 @@ public:
      */
     NodeDataPtr makeData(TypeId const& typeId) const noexcept;
 
+    /**
+     * @brief Writes the type id and the data to `stream`, such that it can be
+     * restored using `deserialize` (e.g. in another process). Null data is
+     * supported.
+     * @param data Data to serialize (may be null)
+     * @param stream Stream to write to
+     * @return success. Fails if the data type does not support serialization
+     * (see `NodeData::serialize`).
+     */
+    bool serialize(NodeDataPtr const& data, QDataStream& stream) const;
+
+    /**
+     * @brief Restores node data that was written using `serialize`. The data
+     * type must be registered.
+     * @param stream Stream to read from
+     * @return Node data (may be null). Empty optional if restoring the data
+     * failed.
+     */
+    tl::optional<NodeDataPtr> deserialize(QDataStream& stream) const;
+
 private:
 
     struct Impl;
@@ -15,6 +15,9 @@
 
 #include <gt_finally.h>
 
+#include <atomic>
+#include <memory>
+
 class GtObject;
 
 namespace intelli
@@ -22,6 +25,10 @@ namespace intelli
 
 using NodeDataPtrList = std::vector<std::pair<PortId, NodeDataPtr>>;
 
+/// Flag shared between an evaluation and its initiator, that is set once the
+/// evaluation should be canceled
+using CancellationToken = std::shared_ptr<std::atomic<bool>>;
+
 class GraphUserVariables;
 /**
  * @brief The NodeDataInterface class.
@@ -49,6 +56,15 @@ public:
      */
     virtual void setNodeEvaluationFailed(NodeUuid const& nodeUuid) {}
 
+    /**
+     * @brief Returns whether the evaluation of the given node was canceled,
+     * i.e. its results are no longer needed. Long running nodes should poll
+     * this flag and return early.
+     * @param nodeUuid Node that is being evaluated
+     * @return Is canceled
+     */
+    virtual bool isEvaluationCanceled(NodeUuid const& nodeUuid) const { return false; }
+
     /**
      * @brief Returns the user variables object if any exists.
      * @return User variables object (may be null)
@@ -0,0 +1,172 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_NODEDATAPOOL_H
+#define GT_INTELLI_NODEDATAPOOL_H
+
+#include <intelli/nodedata.h>
+
+#include <QCoreApplication>
+#include <QThread>
+#include <QVariant>
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace intelli
+{
+
+namespace detail
+{
+
+template <typename T, typename U, typename = void>
+struct is_recyclable : std::false_type {};
+
+/// node data is recyclable if its value can be reassigned
+template <typename T, typename U>
+struct is_recyclable<T, U, decltype(std::declval<T&>().setValue(std::declval<U>()), void())> :
+    std::true_type {};
+
+} // namespace detail
+
+/**
+ * @brief Thread local pool of node data objects of type `T`. Node data objects
+ * are immutable once shared, thus the objects of plain values can be recycled
+ * once they are no longer referenced instead of constructing and destroying a
+ * QObject for each value. Requires `T` to implement `setValue`.
+ *
+ * Only objects released in their own thread are recycled, thus recycled
+ * objects always have the affinity of the acquiring thread. Objects released
+ * in other threads (e.g. data of a detached evaluation) are deleted. The
+ * object name, dynamic properties, and connections of a recycled object are
+ * reset. Objects are only pooled while the application object exists, the
+ * pool of the main thread is cleared once the application is destroyed.
+ */
+template <typename T>
+class NodeDataPool
+{
+public:
+
+    /// Max. number of unused objects kept per thread
+    static constexpr size_t MaxSize = 64;
+
+    /**
+     * @brief Returns a node data object holding `value`. Recycles an unused
+     * object if available.
+     * @param value Value of the node data
+     * @return Node data object (never null)
+     */
+    template <typename U>
+    static std::shared_ptr<T const> make(U&& value)
+    {
+        auto& pool = unused();
+
+        T* data = nullptr;
+        if (pool.empty())
+        {
+            data = new T(std::forward<U>(value));
+        }
+        else
+        {
+            data = pool.back().release();
+            pool.pop_back();
+            assert(data->thread() == QThread::currentThread());
+
+            reset(*data);
+            data->setValue(std::forward<U>(value));
+        }
+
+        return std::shared_ptr<T const>(data, &NodeDataPool::recycle);
+    }
+
+    /**
+     * @brief Returns the number of unused objects of the current thread
+     * @return Number of unused objects
+     */
+    static size_t size() { return unused().size(); }
+
+private:
+
+    static std::vector<std::unique_ptr<T>>& unused()
+    {
+        thread_local std::vector<std::unique_ptr<T>> pool;
+        return pool;
+    }
+
+    /// Clears the pool of the main thread before the application is destroyed
+    static void clearMainThreadPool()
+    {
+        unused().clear();
+    }
+
+    /// Resets the state of a recycled object, that is not part of its value
+    static void reset(T& data)
+    {
+        data.disconnect();
+        data.setObjectName(QString{});
+
+        for (QByteArray const& name : data.dynamicPropertyNames())
+        {
+            data.setProperty(name.constData(), QVariant{});
+        }
+    }
+
+    static void recycle(T const* data)
+    {
+        auto* app = QCoreApplication::instance();
+
+        bool canRecycle = app && !QCoreApplication::closingDown() &&
+                          data->thread() == QThread::currentThread();
+
+        auto& pool = unused();
+        if (!canRecycle || pool.size() >= MaxSize)
+        {
+            delete data;
+            return;
+        }
+
+        // the main thread outlives the application object
+        if (pool.empty() && QThread::currentThread() == app->thread())
+        {
+            static bool const registered = (qAddPostRoutine(&clearMainThreadPool), true);
+            Q_UNUSED(registered);
+        }
+
+        pool.emplace_back(const_cast<T*>(data));
+    }
+};
+
+/**
+ * @brief Creates node data of type `T` holding `value`. Uses the node data
+ * pool if the data type is recyclable (i.e. plain values such as
+ * `DoubleData`), which should be preferred over `std::make_shared` for data
+ * that is created frequently.
+ * @param value Value of the node data
+ * @return Node data object (never null)
+ */
+template <typename T,
+          typename U,
+          std::enable_if_t<detail::is_recyclable<T, U>::value, bool> = true>
+inline std::shared_ptr<T const> makeNodeData(U&& value)
+{
+    return NodeDataPool<T>::make(std::forward<U>(value));
+}
+
+template <typename T,
+          typename U,
+          std::enable_if_t<!detail::is_recyclable<T, U>::value, bool> = true>
+inline std::shared_ptr<T const> makeNodeData(U&& value)
+{
+    return std::make_shared<T const>(std::forward<U>(value));
+}
+
+} // namespace intelli
+
+#endif // GT_INTELLI_NODEDATAPOOL_H
@@ -0,0 +1,361 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/noderesultcache.h"
+
+#include "intelli/node.h"
+#include "intelli/nodedatafactory.h"
+
+#include <gt_coreapplication.h>
+#include <gt_objectmemento.h>
+#include <gt_logging.h>
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+using namespace intelli;
+
+namespace
+{
+
+/// magic number of an entry
+constexpr quint32 s_magic = 0x494e5243; // INRC
+/// version of the format of an entry and of the key
+constexpr quint32 s_version = 1;
+
+/// ids and versions of the loaded modules. The module that registered a node
+/// class is not known, thus the entries of all nodes are invalidated once any
+/// module is updated.
+QByteArray const& moduleVersions()
+{
+    // modules are loaded once on startup
+    static QByteArray const versions = [](){
+        QByteArray bytes;
+        if (!gtApp) return bytes;
+
+        QStringList ids = gtApp->moduleIds();
+        ids.sort();
+
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        for (QString const& id : qAsConst(ids))
+        {
+            stream << id << gtApp->moduleVersion(id).toString();
+        }
+        return bytes;
+    }();
+    return versions;
+}
+
+/// file suffix of an entry
+QString const& entrySuffix()
+{
+    static QString const suffix = QStringLiteral(".result");
+    return suffix;
+}
+
+/// properties of the node, that do not affect its results
+bool isIgnoredProperty(QString const& name)
+{
+    return name == QStringLiteral("id") ||
+           name == QStringLiteral("posX") ||
+           name == QStringLiteral("posY") ||
+           name == QStringLiteral("sizeWidth") ||
+           name == QStringLiteral("sizeHeight");
+}
+
+void hashProperty(QCryptographicHash& hash,
+                  GtObjectMemento::PropertyData const& property)
+{
+    QByteArray bytes;
+    QDataStream stream(&bytes, QIODevice::WriteOnly);
+    stream << property.name << property.data();
+    hash.addData(bytes);
+
+    for (auto const& child : property.childProperties)
+    {
+        hashProperty(hash, child);
+    }
+}
+
+/// the uuid and name of the objects are not considered
+void hashMemento(QCryptographicHash& hash,
+                 GtObjectMemento const& memento,
+                 bool isNode)
+{
+    hash.addData(memento.className().toUtf8());
+
+    for (auto const& property : memento.properties)
+    {
+        if (isNode && isIgnoredProperty(property.name)) continue;
+
+        hashProperty(hash, property);
+    }
+
+    for (auto const& child : memento.childObjects)
+    {
+        hashMemento(hash, child, false);
+    }
+}
+
+} // namespace
+
+struct NodeResultCache::Impl
+{
+    /// directory of the entries
+    QDir dir;
+    /// max. size in bytes
+    qint64 maxSize;
+    /// size of all entries in bytes, updated as entries are added and removed
+    qint64 size = 0;
+
+    /// Returns the file path of the entry
+    QString filePath(QByteArray const& key) const
+    {
+        return dir.filePath(QString::fromLatin1(key.toHex()) + entrySuffix());
+    }
+
+    /// Returns all entries sorted by their last access (most recent first)
+    QFileInfoList entries() const
+    {
+        return dir.entryInfoList({QStringLiteral("*") + entrySuffix()},
+                                 QDir::Files, QDir::Time);
+    }
+
+    /// Returns the size of an entry (zero if it does not exist)
+    qint64 entrySize(QByteArray const& key) const
+    {
+        QFileInfo info(filePath(key));
+        return info.exists() ? info.size() : 0;
+    }
+};
+
+NodeResultCache::NodeResultCache(QString directory, qint64 maxSize) :
+    pimpl(std::make_unique<Impl>(Impl{QDir(directory), std::max(maxSize, 0ll)}))
+{
+    if (!pimpl->dir.mkpath(QStringLiteral(".")))
+    {
+        gtWarning() << QObject::tr("Failed to create node result cache '%1'!")
+                           .arg(directory);
+    }
+
+    // entries of previous sessions
+    for (QFileInfo const& entry : pimpl->entries())
+    {
+        pimpl->size += entry.size();
+    }
+    evict();
+}
+
+NodeResultCache::~NodeResultCache() = default;
+
+std::shared_ptr<NodeResultCache>
+NodeResultCache::defaultCache()
+{
+    static auto cache = std::make_shared<NodeResultCache>();
+    return cache;
+}
+
+QString
+NodeResultCache::defaultDirectory()
+{
+    return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+        .filePath(QStringLiteral("intelligraph/results"));
+}
+
+QByteArray
+NodeResultCache::key(Node const& node, NodeDataPtrList const& inData)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    {
+        QByteArray bytes;
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream << s_version << node.cacheVersion();
+        hash.addData(bytes);
+    }
+
+    hash.addData(moduleVersions());
+
+    hashMemento(hash, node.toMemento(), true);
+
+    auto& factory = NodeDataFactory::instance();
+
+    for (auto const& entry : inData)
+    {
+        QByteArray bytes;
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream << entry.first.value();
+
+        if (!factory.serialize(entry.second, stream)) return {};
+
+        hash.addData(bytes);
+    }
+
+    return hash.result();
+}
+
+QString
+NodeResultCache::directory() const
+{
+    return pimpl->dir.absolutePath();
+}
+
+void
+NodeResultCache::setMaxSize(qint64 maxSize)
+{
+    pimpl->maxSize = std::max(maxSize, 0ll);
+    evict();
+}
+
+qint64
+NodeResultCache::maxSize() const
+{
+    return pimpl->maxSize;
+}
+
+qint64
+NodeResultCache::size() const
+{
+    return pimpl->size;
+}
+
+bool
+NodeResultCache::contains(QByteArray const& key) const
+{
+    return !key.isEmpty() && QFile::exists(pimpl->filePath(key));
+}
+
+bool
+NodeResultCache::store(QByteArray const& key, NodeDataPtrList const& outData)
+{
+    if (key.isEmpty()) return false;
+
+    auto& factory = NodeDataFactory::instance();
+
+    QByteArray bytes;
+    {
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        stream << s_magic << s_version << (quint64)outData.size();
+
+        for (auto const& entry : outData)
+        {
+            stream << entry.first.value();
+            if (!factory.serialize(entry.second, stream)) return false;
+        }
+    }
+
+    qint64 oldSize = pimpl->entrySize(key);
+
+    // entries may be read by other processes concurrently
+    QSaveFile file(pimpl->filePath(key));
+    if (!file.open(QIODevice::WriteOnly) ||
+        file.write(bytes) != bytes.size() ||
+        !file.commit())
+    {
+        gtWarning() << QObject::tr("Failed to store node result in cache! (%1)")
+                           .arg(file.errorString());
+        return false;
+    }
+
+    pimpl->size += bytes.size() - oldSize;
+    if (pimpl->size > pimpl->maxSize) evict();
+
+    return true;
+}
+
+tl::optional<NodeDataPtrList>
+NodeResultCache::load(QByteArray const& key) const
+{
+    if (key.isEmpty()) return {};
+
+    QFile file(pimpl->filePath(key));
+    if (!file.open(QIODevice::ReadWrite)) return {};
+
+    QByteArray bytes = file.readAll();
+
+    // mark entry as recently used
+    file.setFileTime(QDateTime::currentDateTime(),
+                     QFileDevice::FileModificationTime);
+
+    QDataStream stream(bytes);
+
+    quint32 magic = 0, version = 0;
+    quint64 size = 0;
+    stream >> magic >> version >> size;
+    if (stream.status() != QDataStream::Ok ||
+        magic != s_magic || version != s_version)
+    {
+        return {};
+    }
+
+    auto& factory = NodeDataFactory::instance();
+
+    NodeDataPtrList outData;
+    outData.reserve(size);
+    for (quint64 i = 0; i < size; ++i)
+    {
+        PortId::value_type portId{};
+        stream >> portId;
+
+        auto data = factory.deserialize(stream);
+        if (!data || stream.status() != QDataStream::Ok) return {};
+
+        outData.push_back({PortId(portId), std::move(*data)});
+    }
+
+    return outData;
+}
+
+bool
+NodeResultCache::remove(QByteArray const& key)
+{
+    if (key.isEmpty()) return false;
+
+    qint64 size = pimpl->entrySize(key);
+    if (!QFile::remove(pimpl->filePath(key))) return false;
+
+    pimpl->size = std::max(pimpl->size - size, 0ll);
+    return true;
+}
+
+void
+NodeResultCache::clear()
+{
+    for (QFileInfo const& entry : pimpl->entries())
+    {
+        QFile::remove(entry.absoluteFilePath());
+    }
+    pimpl->size = 0;
+}
+
+void
+NodeResultCache::evict()
+{
+    if (pimpl->size <= pimpl->maxSize) return;
+
+    // the entries are only scanned once the cache exceeds its max. size, the
+    // size is updated to include changes of other processes
+    qint64 size = 0;
+    for (QFileInfo const& entry : pimpl->entries())
+    {
+        if (size + entry.size() <= pimpl->maxSize)
+        {
+            size += entry.size();
+            continue;
+        }
+
+        if (!QFile::remove(entry.absoluteFilePath())) size += entry.size();
+    }
+    pimpl->size = size;
+}
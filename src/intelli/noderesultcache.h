@@ -0,0 +1,173 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_NODERESULTCACHE_H
+#define GT_INTELLI_NODERESULTCACHE_H
+
+#include <intelli/exports.h>
+#include <intelli/nodedatainterface.h>
+
+#include <tl/optional.hpp>
+
+#include <QByteArray>
+#include <QString>
+
+#include <memory>
+
+namespace intelli
+{
+
+class Node;
+
+/**
+ * @brief The NodeResultCache class. Persistent, content-addressed cache for
+ * the output data of nodes. Results are stored on disk and may thus be shared
+ * across sessions and processes. An entry is identified by the class of the
+ * node, its properties (excluding its id, position, and size), and the data of
+ * its inputs (see `NodeResultCache::key`). Thus only nodes, whose outputs
+ * depend solely on these, should be cached (see `NodeFlag::Cacheable`).
+ * Entries are invalidated once a module is updated or the cache version of the
+ * node is incremented (see `Node::setCacheVersion`).
+ *
+ * The entries are evicted in least recently used order once the cache exceeds
+ * its max. size. Only node data that supports serialization can be cached
+ * (see `NodeData::serialize`).
+ */
+class NodeResultCache
+{
+public:
+
+    /**
+     * @brief Constructor
+     * @param directory Directory in which the entries are stored. Is created
+     * if it does not exist.
+     * @param maxSize Max. size of the cache in bytes
+     */
+    GT_INTELLI_EXPORT
+    explicit NodeResultCache(QString directory = defaultDirectory(),
+                             qint64 maxSize = 1024ll * 1024 * 1024);
+    GT_INTELLI_EXPORT ~NodeResultCache();
+
+    NodeResultCache(NodeResultCache const&) = delete;
+    NodeResultCache& operator=(NodeResultCache const&) = delete;
+
+    /**
+     * @brief Returns the cache that is shared by the exec models of the
+     * application (e.g. of the graph editor). Is located in the default
+     * directory.
+     * @return Default cache
+     */
+    GT_INTELLI_EXPORT
+    static std::shared_ptr<NodeResultCache> defaultCache();
+
+    /**
+     * @brief Returns the default directory of the cache, which is located in
+     * the cache directory of the user.
+     * @return Directory path
+     */
+    GT_INTELLI_EXPORT
+    static QString defaultDirectory();
+
+    /**
+     * @brief Computes the key of the entry for the given node and input data.
+     * Includes the cache version of the node and the versions of the loaded
+     * modules.
+     * @param node Node
+     * @param inData Input data of the node
+     * @return Key. Empty if the input data cannot be serialized.
+     */
+    GT_INTELLI_EXPORT
+    static QByteArray key(Node const& node, NodeDataPtrList const& inData);
+
+    /**
+     * @brief Returns the directory of the cache
+     * @return Directory path
+     */
+    GT_INTELLI_EXPORT
+    QString directory() const;
+
+    /**
+     * @brief Sets the max. size of the cache. Evicts entries if necessary.
+     * @param maxSize Max. size in bytes
+     */
+    GT_INTELLI_EXPORT
+    void setMaxSize(qint64 maxSize);
+
+    /**
+     * @brief Returns the max. size of the cache
+     * @return Max. size in bytes
+     */
+    GT_INTELLI_EXPORT
+    qint64 maxSize() const;
+
+    /**
+     * @brief Returns the size of all entries in the cache. The size is tracked
+     * as entries are added and removed.
+     * @return Size in bytes
+     */
+    GT_INTELLI_EXPORT
+    qint64 size() const;
+
+    /**
+     * @brief Returns whether an entry exists for the given key
+     * @param key Key of the entry
+     * @return Contains entry
+     */
+    GT_INTELLI_EXPORT
+    bool contains(QByteArray const& key) const;
+
+    /**
+     * @brief Stores the output data for the given key. An existing entry is
+     * replaced. Evicts entries if the cache exceeds its max. size.
+     * @param key Key of the entry
+     * @param outData Output data of the node
+     * @return success. Fails if the output data cannot be serialized.
+     */
+    GT_INTELLI_EXPORT
+    bool store(QByteArray const& key, NodeDataPtrList const& outData);
+
+    /**
+     * @brief Loads the output data for the given key. Marks the entry as
+     * recently used.
+     * @param key Key of the entry
+     * @return Output data (null if the entry was not found or is corrupted)
+     */
+    GT_INTELLI_EXPORT
+    tl::optional<NodeDataPtrList> load(QByteArray const& key) const;
+
+    /**
+     * @brief Removes the entry for the given key
+     * @param key Key of the entry
+     * @return Whether the entry was removed
+     */
+    GT_INTELLI_EXPORT
+    bool remove(QByteArray const& key);
+
+    /**
+     * @brief Removes all entries
+     */
+    GT_INTELLI_EXPORT
+    void clear();
+
+    /**
+     * @brief Removes the least recently used entries until the cache does
+     * not exceed its max. size.
+     */
+    GT_INTELLI_EXPORT
+    void evict();
+
+private:
+
+    struct Impl;
+    std::unique_ptr<Impl> pimpl;
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_NODERESULTCACHE_H
@@ -0,0 +1,160 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "intelli/parallel.h"
+
+#include <QMutex>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+#include <atomic>
+#include <exception>
+
+using namespace intelli;
+
+namespace
+{
+
+/// State shared between the calling thread and the helper tasks
+struct ParallelState
+{
+    size_t count;
+    size_t grainSize;
+    std::function<void(size_t, size_t)> const& func;
+
+    /// first index of the next chunk
+    std::atomic<size_t> next{0};
+    /// set once the remaining chunks should be skipped
+    std::atomic<bool> stop{false};
+
+    QMutex mutex;
+    QWaitCondition finished;
+    /// number of running helper tasks
+    size_t running = 0;
+    /// first exception thrown
+    std::exception_ptr exception;
+
+    /// Processes a single chunk. Returns false if no chunk is left.
+    bool processNext()
+    {
+        if (stop) return false;
+
+        size_t begin = next.fetch_add(grainSize);
+        if (begin >= count) return false;
+
+        try
+        {
+            func(begin, std::min(begin + grainSize, count));
+        }
+        catch (...)
+        {
+            QMutexLocker locker{&mutex};
+            if (!exception) exception = std::current_exception();
+            stop = true;
+        }
+        return true;
+    }
+};
+
+/// Helper task that processes chunks until none is left
+class ParallelTask : public QRunnable
+{
+public:
+
+    explicit ParallelTask(ParallelState& state) : m_state(state) {}
+
+    void run() override
+    {
+        while (m_state.processNext()) { }
+
+        QMutexLocker locker{&m_state.mutex};
+        if (--m_state.running == 0) m_state.finished.wakeAll();
+    }
+
+private:
+
+    ParallelState& m_state;
+};
+
+} // namespace
+
+size_t
+exec::grainSize(size_t count, ParallelOptions const& options)
+{
+    if (options.grainSize > 0) return options.grainSize;
+
+    // a few chunks per thread to balance the load
+    size_t threads = (size_t)std::max(1, QThread::idealThreadCount());
+    return std::max<size_t>(1, count / (4 * threads));
+}
+
+bool
+exec::parallelFor(size_t count,
+                  std::function<void(size_t, size_t)> const& func,
+                  ParallelOptions const& options)
+{
+    if (count == 0) return true;
+
+    ParallelState state{count, grainSize(count, options), func};
+
+    size_t chunks = (count + state.grainSize - 1) / state.grainSize;
+    size_t maxConcurrency = options.maxConcurrency > 0 ?
+                                options.maxConcurrency :
+                                (size_t)std::max(1, QThread::idealThreadCount());
+    size_t helpers = std::min(chunks, maxConcurrency) - 1;
+
+    // only idle threads are used, such that running evaluations are not
+    // delayed by the tasks
+    auto* pool = QThreadPool::globalInstance();
+    for (size_t i = 0; i < helpers; ++i)
+    {
+        auto* task = new ParallelTask(state);
+        task->setAutoDelete(true);
+
+        {
+            QMutexLocker locker{&state.mutex};
+            state.running++;
+        }
+
+        if (!pool->tryStart(task))
+        {
+            delete task;
+
+            QMutexLocker locker{&state.mutex};
+            state.running--;
+            break;
+        }
+    }
+
+    // the calling thread processes chunks as well and polls the cancellation
+    bool canceled = false;
+    while (true)
+    {
+        if (options.isCanceled && state.next < count && options.isCanceled())
+        {
+            canceled = true;
+            state.stop = true;
+            break;
+        }
+
+        if (!state.processNext()) break;
+    }
+
+    QMutexLocker locker{&state.mutex};
+    while (state.running > 0)
+    {
+        state.finished.wait(&state.mutex);
+    }
+
+    if (state.exception) std::rethrow_exception(state.exception);
+
+    return !canceled;
+}
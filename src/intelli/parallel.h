@@ -0,0 +1,114 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_PARALLEL_H
+#define GT_INTELLI_PARALLEL_H
+
+#include <intelli/exports.h>
+
+#include <tl/optional.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace intelli
+{
+
+namespace exec
+{
+
+/// Options of the parallel algorithms
+struct ParallelOptions
+{
+    /// number of consecutive indices processed by a single task. Zero
+    /// determines the grain size based on the number of indices and cores.
+    size_t grainSize = 0;
+    /// max. number of threads, including the calling thread. Zero denotes the
+    /// number of cores.
+    size_t maxConcurrency = 0;
+    /// predicate that is polled by the calling thread before each task. Once
+    /// it returns true, the remaining tasks are skipped.
+    std::function<bool()> isCanceled;
+};
+
+/**
+ * @brief Returns the number of consecutive indices processed by a single task.
+ * @param count Number of indices
+ * @param options Options
+ * @return Grain size (at least one)
+ */
+GT_INTELLI_EXPORT
+size_t grainSize(size_t count, ParallelOptions const& options = {});
+
+/**
+ * @brief Invokes `func` for all indices in the range [0, count) in parallel.
+ * The range is split into chunks of `grainSize` indices, which are processed
+ * by the calling thread and by threads of the global thread pool, that are
+ * idle when the function is called. Other than `QtConcurrent`, no tasks are
+ * queued in the thread pool, thus the thread pool is not oversubscribed. If no
+ * thread is idle, all chunks are processed by the calling thread. The calling
+ * thread and the helper threads process chunks until none are left, thus
+ * detached node evaluations started meanwhile may be delayed until the range
+ * is processed. The function returns once all running chunks finished.
+ * Exceptions thrown by `func` are rethrown in the calling thread once all
+ * running tasks finished.
+ * @param count Number of indices
+ * @param func Function invoked for each chunk with the range [begin, end)
+ * @param options Options
+ * @return Whether all chunks were processed, i.e. false if canceled
+ */
+GT_INTELLI_EXPORT
+bool parallelFor(size_t count,
+                 std::function<void(size_t begin, size_t end)> const& func,
+                 ParallelOptions const& options = {});
+
+/**
+ * @brief Reduces the range [0, count) in parallel. Each chunk of the range is
+ * mapped to a partial result using `map`, the partial results are combined
+ * in order using `reduce`. Thus the result is deterministic for a fixed grain
+ * size, even if `reduce` is not associative (e.g. summing floating point
+ * numbers). See `parallelFor` for further details.
+ * @param count Number of indices
+ * @param identity Initial value of the result and of each partial result
+ * @param map Function returning the partial result of the range [begin, end)
+ * @param reduce Function combining two results
+ * @param options Options
+ * @return Result (null if canceled)
+ */
+template <typename T, typename Map, typename Reduce>
+inline tl::optional<T>
+parallelReduce(size_t count,
+               T identity,
+               Map map,
+               Reduce reduce,
+               ParallelOptions options = {})
+{
+    options.grainSize = grainSize(count, options);
+
+    std::vector<T> partials((count + options.grainSize - 1) / options.grainSize,
+                            identity);
+
+    bool success = parallelFor(count, [&](size_t begin, size_t end){
+        partials[begin / options.grainSize] = map(begin, end);
+    }, options);
+
+    if (!success) return {};
+
+    for (T& partial : partials)
+    {
+        identity = reduce(std::move(identity), std::move(partial));
+    }
+    return identity;
+}
+
+} // namespace exec
+
+} // namespace intelli
+
+#endif // GT_INTELLI_PARALLEL_H
@@ -0,0 +1,144 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_ARRAYKERNELS_H
+#define GT_INTELLI_ARRAYKERNELS_H
+
+#include <intelli/view.h>
+
+#include <tl/optional.hpp>
+
+#include <algorithm>
+
+/// hint that the pointers do not alias, such that the loops are vectorized
+#if defined(_MSC_VER)
+#define GT_INTELLI_RESTRICT __restrict
+#else
+#define GT_INTELLI_RESTRICT __restrict__
+#endif
+
+namespace intelli
+{
+
+/**
+ * Element-wise kernels of the array nodes. The kernels operate on a range of
+ * the output, such that the arrays can be processed in parallel chunks (see
+ * `Node::parallelFor`). Each kernel is a plain loop over contiguous memory
+ * without branches or aliasing, which the compiler vectorizes using the SIMD
+ * instructions of the target. Arrays of size one are broadcasted.
+ */
+namespace kernel
+{
+
+/// number of elements processed by a single task
+constexpr size_t GrainSize = 1 << 14;
+
+/**
+ * @brief Returns the size of the result of an element-wise operation. Arrays
+ * of size one are broadcasted.
+ * @param a Size of array a
+ * @param b Size of array b
+ * @return Size of the result (null if the sizes are incompatible)
+ */
+inline tl::optional<size_t>
+broadcastSize(size_t a, size_t b)
+{
+    if (a == b || b == 1) return a;
+    if (a == 1) return b;
+    return {};
+}
+
+/**
+ * @brief Applies `op` element-wise to `a` and `b` within the range
+ * [begin, end) of the output. The sizes must be compatible (see
+ * `broadcastSize`).
+ * @param a Array a
+ * @param b Array b
+ * @param out Output array
+ * @param begin First index
+ * @param end Last index (exclusive)
+ * @param op Binary operation
+ */
+template <typename T, typename R, typename Op>
+inline void
+binary(View<T> a, View<T> b, R* GT_INTELLI_RESTRICT out,
+       size_t begin, size_t end, Op op)
+{
+    T const* GT_INTELLI_RESTRICT pa = a.data();
+    T const* GT_INTELLI_RESTRICT pb = b.data();
+
+    if (a.size() == b.size())
+    {
+        for (size_t i = begin; i < end; ++i) out[i] = op(pa[i], pb[i]);
+    }
+    else if (a.size() == 1)
+    {
+        T const sa = pa[0];
+        for (size_t i = begin; i < end; ++i) out[i] = op(sa, pb[i]);
+    }
+    else
+    {
+        T const sb = pb[0];
+        for (size_t i = begin; i < end; ++i) out[i] = op(pa[i], sb);
+    }
+}
+
+/**
+ * @brief Applies `op` element-wise to `a` within the range [begin, end).
+ * @param a Array a
+ * @param out Output array
+ * @param begin First index
+ * @param end Last index (exclusive)
+ * @param op Unary operation
+ */
+template <typename T, typename R, typename Op>
+inline void
+unary(View<T> a, R* GT_INTELLI_RESTRICT out, size_t begin, size_t end, Op op)
+{
+    T const* GT_INTELLI_RESTRICT pa = a.data();
+    for (size_t i = begin; i < end; ++i) out[i] = op(pa[i]);
+}
+
+/**
+ * @brief Reduces the range [begin, end) of `a` using `op`. Uses independent
+ * accumulators, such that the loop is vectorized without reordering the
+ * operations of a single accumulator.
+ * @param a Array
+ * @param begin First index
+ * @param end Last index (exclusive)
+ * @param init Initial value of each accumulator
+ * @param op Binary operation (e.g. sum, min, or max)
+ * @return Result
+ */
+template <typename T, typename Op>
+inline T
+reduce(View<T> a, size_t begin, size_t end, T init, Op op)
+{
+    constexpr size_t N = 4;
+
+    T const* GT_INTELLI_RESTRICT pa = a.data();
+
+    T acc[N];
+    std::fill(acc, acc + N, init);
+
+    size_t i = begin;
+    for (; i + N <= end; i += N)
+    {
+        for (size_t j = 0; j < N; ++j) acc[j] = op(acc[j], pa[i + j]);
+    }
+    for (; i < end; ++i) acc[0] = op(acc[0], pa[i]);
+
+    return op(op(acc[0], acc[1]), op(acc[2], acc[3]));
+}
+
+} // namespace kernel
+
+} // namespace intelli
+
+#endif // GT_INTELLI_ARRAYKERNELS_H
@@ -13,6 +13,7 @@
 #include <intelli/graph.h>
 #include <intelli/connection.h>
 #include <intelli/nodedatafactory.h>
+#include <intelli/node/groupoutputprovider.h>
 #include <intelli/private/utils.h>
 
 #include <gt_logging.h>
@@ -29,9 +30,6 @@ struct Graph::Impl
     std::shared_ptr<GlobalConnectionModel> global = std::make_shared<GlobalConnectionModel>();
     /// indicator if the connection model is currently beeing modified
     int modificationCount = 0;
-    /// flag indicating that the connection model should be reset once
-    /// the graph is no longer being modified
-    bool resetAfterModification = false;
 
     template <typename MakeError = QString(*)()>
     static inline bool
@@ -271,6 +269,55 @@ struct Graph::Impl
         }
     }
 
+    /// moves the entries of all nodes of `graph` (recursively) from the
+    /// current global connection model into a separate global connection model.
+    /// Must only be called once `graph` was removed from its parent graph, such
+    /// that no connections to nodes outside of `graph` remain.
+    static inline void
+    detachGlobalConnectionModel(Graph& graph,
+                                std::shared_ptr<GlobalConnectionModel> const& detached)
+    {
+        auto& global = *graph.pimpl->global;
+        for (auto& entry : graph.pimpl->local)
+        {
+            auto iter = global.find(entry.node->uuid());
+            if (iter == global.end()) continue;
+
+            detached->insert(iter.key(), iter.value());
+            global.erase(iter);
+        }
+
+        for (Graph* subgraph : graph.graphNodes())
+        {
+            detachGlobalConnectionModel(*subgraph, detached);
+        }
+
+        graph.pimpl->global = detached;
+    }
+
+    /// restores the global connections that forward the outputs of `graph`
+    /// to the graph node itself. These connections are not guarded by a local
+    /// connection and are therefore lost once the graph node is removed from
+    /// its parent graph (e.g. when moving the graph node).
+    static inline void
+    restoreOutputForwarding(Graph& graph)
+    {
+        auto* output = graph.outputProvider();
+        if (!output) return;
+
+        for (ConnectionId conId :
+             graph.pimpl->local.iterateConnections(output->id(), PortType::In))
+        {
+            ConnectionUuid conUuid = graph.connectionUuid(conId);
+            conUuid.outNodeId = output->uuid();
+            conUuid.outPort   = GroupOutputProvider::virtualPortId(conUuid.inPort);
+            conUuid.inNodeId  = graph.uuid();
+            conUuid.inPort    = conUuid.outPort;
+
+            graph.appendGlobalConnection(nullptr, std::move(conUuid));
+        }
+    }
+
     /// Functor to handle port deletion
     struct PortDeleted
     {
@@ -13,6 +13,10 @@
 #include <intelli/graphexecmodel.h>
 #include <intelli/graph.h>
 #include <intelli/node.h>
+#include <intelli/nodedata.h>
+#include <intelli/nodedatafactory.h>
+#include <intelli/noderesultcache.h>
+#include <intelli/node/groupoutputprovider.h>
 
 #include <intelli/private/utils.h>
 
@@ -21,8 +25,18 @@
 
 #include <gt_logging.h>
 
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QHash>
 #include <QMutex>
 #include <QMutexLocker>
+#include <QTemporaryDir>
+#include <QTimer>
+
+#include <chrono>
+#include <map>
+#include <unordered_map>
 
 #ifdef GT_INTELLI_DEBUG_NODE_EXEC
 
@@ -127,6 +141,84 @@ struct GraphExecutionModel::Impl
     int modificationCount = 0;
     /// indicator if queue is currently being evaluated
     bool isEvaluatingQueue = false;
+    /// whether running evaluations of nodes should be canceled once their
+    /// inputs change
+    bool cancelSupersededEvaluations = true;
+    /// window in which successive triggers of a node are coalesced
+    std::chrono::milliseconds debounceInterval{0};
+    /// windows of individual nodes, overriding the default window
+    QHash<NodeUuid, std::chrono::milliseconds> nodeDebounceIntervals;
+    /// triggered nodes and the time at which they should be auto evaluated
+    std::map<NodeUuid, std::chrono::steady_clock::time_point> debouncedNodes;
+    /// timer for auto evaluating debounced nodes
+    QTimer debounceTimer;
+    /// whether the output data of nodes should be released once all consumers
+    /// have been evaluated
+    bool releaseIntermediateData = false;
+    /// nodes whose data must not be released
+    std::set<NodeUuid> pinnedNodes;
+    /// max. number of output ports holding data at once
+    size_t peakNodeDataCount = 0;
+    /// number of output ports whose data was released
+    size_t releasedNodeDataCount = 0;
+    /// max. number of bytes of node data held at once
+    size_t peakMemoryUsage = 0;
+    /// number of bytes of node data that was released
+    size_t releasedNodeDataSize = 0;
+
+    /// identifies an output port of a node
+    using PortKey = std::pair<NodeUuid, PortId>;
+
+    /// Output data that was spilled to disk
+    struct SpilledData
+    {
+        /// file containing the serialized data
+        QString filePath;
+        /// whether the file is compressed
+        bool compressed = false;
+    };
+
+    /// max. number of bytes of node data held in memory (zero if unlimited)
+    size_t memoryBudget = 0;
+    /// directory in which spilled data is stored (temp dir if empty)
+    QString spillDirectory;
+    /// whether spilled data should be compressed
+    bool compressSpilledData = false;
+    /// directory that is created on demand to store spilled data
+    std::unique_ptr<QTemporaryDir> spillDir;
+    /// output ports whose data was spilled to disk
+    std::map<PortKey, SpilledData> spilledData;
+    /// last access of the data of output ports
+    std::map<PortKey, quint64> dataAccess;
+    /// counter used to determine the least recently used data
+    quint64 accessCounter = 0;
+    /// counter used to generate the file names of spilled data
+    quint64 spillCounter = 0;
+
+    /// persistent cache for the results of cacheable nodes
+    std::shared_ptr<NodeResultCache> resultCache;
+    /// cache keys of evaluating nodes, whose results should be cached
+    QHash<NodeUuid, QByteArray> cacheKeys;
+
+    /// Subscription to the completion of target nodes (e.g. by a future)
+    struct Subscription
+    {
+        /// all target nodes
+        std::vector<NodeUuid> targets;
+        /// number of target nodes that have not been evaluated yet
+        size_t remaining = 0;
+        /// invoked once all targets have evaluated or a target failed
+        CompletionCallback callback;
+    };
+
+    /// active subscriptions
+    std::unordered_map<size_t, Subscription> subscriptions;
+    /// subscriptions that wait for the evaluation of a node
+    QHash<NodeUuid, std::vector<size_t>> subscribers;
+    /// failed nodes with subscribers, that have yet to be notified
+    std::vector<NodeUuid> failedNodes;
+    /// id of the last subscription
+    size_t lastSubscription = 0;
 
     struct Synchronization
     {
@@ -140,10 +232,32 @@ struct GraphExecutionModel::Impl
             bool isExclusiveNodeRunning = false;
         };
 
+        struct ResourceEntry
+        {
+            /// number of nodes accessing the resource using shared access
+            size_t sharedAccesses = 0;
+            /// Indicates whether a node is accessing the resource exclusively
+            bool isAccessedExclusively = false;
+        };
+
+        struct AcquiredResources
+        {
+            /// exec model of the node (used as key only)
+            GraphExecutionModel const* model = nullptr;
+            /// node that acquired the resources
+            NodeUuid nodeUuid;
+            /// acquired resources
+            NodeResources resources;
+        };
+
         /// mutex for coarse locking
         QMutex mutex;
         /// registered entries
         QVector<SynchronizationEntry> entries;
+        /// resources that are currently in use
+        QHash<QString, ResourceEntry> resources;
+        /// resources acquired by the nodes that are currently evaluated
+        std::vector<AcquiredResources> acquiredResources;
 
         /**
          * @brief Returns whether any graph exec model is currently evaluating
@@ -204,6 +318,148 @@ struct GraphExecutionModel::Impl
             }
         }
 
+        /**
+         * @brief Merges resources of the same name, such that each resource
+         * is only accessed once using the strongest access mode.
+         * @param resources Resources to normalize
+         * @return Normalized resources
+         */
+        static NodeResources normalized(NodeResources resources)
+        {
+            std::sort(resources.begin(), resources.end(),
+                      [](NodeResource const& a, NodeResource const& b){
+                if (a.name != b.name) return a.name < b.name;
+                return a.access > b.access;
+            });
+            resources.erase(std::unique(resources.begin(), resources.end(),
+                                        [](NodeResource const& a,
+                                           NodeResource const& b){
+                return a.name == b.name;
+            }), resources.end());
+            return resources;
+        }
+
+        /**
+         * @brief Returns whether all resources can be acquired. Mutex must be
+         * locked.
+         * @param resources Normalized resources to check
+         * @return Whether the resources are available
+         */
+        bool canAcquire(NodeResources const& resources) const
+        {
+            return std::all_of(resources.begin(), resources.end(),
+                               [this](NodeResource const& resource){
+                auto iter = this->resources.find(resource.name);
+                if (iter == this->resources.end()) return true;
+
+                if (iter->isAccessedExclusively) return false;
+                if (resource.access == ResourceAccess::Exclusive)
+                {
+                    return iter->sharedAccesses == 0;
+                }
+
+                size_t capacity = exec::resourceCapacity(resource.name);
+                return capacity == 0 || iter->sharedAccesses < capacity;
+            });
+        }
+
+        /**
+         * @brief Acquires all resources for the given node. Resources must be
+         * available (see `canAcquire`). Mutex must be locked.
+         * @param model Exec model of the node
+         * @param nodeUuid Node that acquires the resources
+         * @param resources Normalized resources to acquire
+         */
+        void acquire(GraphExecutionModel const& model,
+                     NodeUuid const& nodeUuid,
+                     NodeResources resources)
+        {
+            if (resources.empty()) return;
+
+            for (NodeResource const& resource : resources)
+            {
+                auto& entry = this->resources[resource.name];
+                if (resource.access == ResourceAccess::Exclusive)
+                {
+                    entry.isAccessedExclusively = true;
+                    continue;
+                }
+                entry.sharedAccesses += 1;
+            }
+
+            acquiredResources.push_back({&model, nodeUuid, std::move(resources)});
+        }
+
+        /**
+         * @brief Releases all resources acquired by the given node. Notifies
+         * all other models if resources were released.
+         * @param model Exec model of the node
+         * @param nodeUuid Node that acquired the resources
+         */
+        void release(GraphExecutionModel& model, NodeUuid const& nodeUuid)
+        {
+            QMutexLocker locker{&mutex};
+
+            auto iter = std::find_if(acquiredResources.begin(),
+                                     acquiredResources.end(),
+                                     [&model, &nodeUuid](AcquiredResources const& e){
+                return e.model == &model && e.nodeUuid == nodeUuid;
+            });
+            if (iter == acquiredResources.end()) return;
+
+            releaseResources(iter->resources);
+            acquiredResources.erase(iter);
+
+            locker.unlock();
+            notify(model);
+        }
+
+        /**
+         * @brief Releases all resources acquired by the nodes of the given
+         * model. Mutex must be locked.
+         * @param model Exec model
+         */
+        void releaseAll(GraphExecutionModel const& model)
+        {
+            auto iter = std::remove_if(acquiredResources.begin(),
+                                       acquiredResources.end(),
+                                       [this, &model](AcquiredResources const& e){
+                if (e.model != &model) return false;
+                releaseResources(e.resources);
+                return true;
+            });
+            acquiredResources.erase(iter, acquiredResources.end());
+        }
+
+        /**
+         * @brief Decrements the accesses of the given resources. Mutex must be
+         * locked.
+         * @param resources Resources to release
+         */
+        void releaseResources(NodeResources const& resources)
+        {
+            for (NodeResource const& resource : resources)
+            {
+                auto entry = this->resources.find(resource.name);
+                assert(entry != this->resources.end());
+
+                if (resource.access == ResourceAccess::Exclusive)
+                {
+                    entry->isAccessedExclusively = false;
+                }
+                else
+                {
+                    assert(entry->sharedAccesses > 0);
+                    entry->sharedAccesses -= 1;
+                }
+
+                if (!entry->isAccessedExclusively && entry->sharedAccesses == 0)
+                {
+                    this->resources.erase(entry);
+                }
+            }
+        }
+
         void update(GraphExecutionModel& model)
         {
             if (model.pimpl->evaluatingNodes.size() > 0) return;
@@ -266,6 +522,25 @@ struct GraphExecutionModel::Impl
         }
     }
 
+    /// Finds all sink nodes of the graph and its subgraphs.
+    template<typename List>
+    static inline void
+    findSinkNodes(Graph const& graph, List& targetNodes)
+    {
+        for (Node const* node : graph.nodes())
+        {
+            if (node->nodeFlags() & NodeFlag::Sink)
+            {
+                targetNodes.push_back(node->uuid());
+            }
+        }
+
+        for (Graph const* subgraph : graph.graphNodes())
+        {
+            findSinkNodes(*subgraph, targetNodes);
+        }
+    }
+
     static inline bool
     containsGraph(GraphExecutionModel const& model,
                      Graph const& graph)
@@ -466,7 +741,10 @@ struct GraphExecutionModel::Impl
             return entry->state == NodeEvalState::Outdated;
         }
 
-        bool inputsValid() const
+        /// Checks whether the data of the input ports, that are accepted by
+        /// `isSelected`, is valid
+        template <typename Predicate>
+        bool inputsValid(Predicate isSelected) const
         {
             auto& conModel = execModel->graph().globalConnectionModel();
             auto conData = conModel.find(node->uuid());
@@ -474,12 +752,16 @@ struct GraphExecutionModel::Impl
 
             bool valid =
                 std::all_of(entry->portsIn.begin(), entry->portsIn.end(),
-                            [conData, this](PortDataItem const& entry){
+                            [conData, &isSelected, this](PortDataItem const& entry){
+                auto* port = node->port(entry.portId);
+                if (port && !isSelected(*port)) return true;
+
                 bool isConnected = conData->hasConnections(entry.portId, PortType::In);
                 bool isPortDataValid = entry.data.state == PortDataState::Valid;
 
-                auto* port = node->port(entry.portId);
-                bool hasRequiredData = port && (port->optional || entry.data.ptr);
+                bool hasRequiredData =
+                    port && (port->optional || entry.data.ptr ||
+                             isNodeDataSpilled(*execModel, *node, entry.portId));
 
                 return (!isConnected || isPortDataValid) && hasRequiredData;
             });
@@ -487,6 +769,50 @@ struct GraphExecutionModel::Impl
             return valid;
         }
 
+        bool inputsValid() const
+        {
+            if (!inputsValid([](Node::PortInfo const& port){ return !port.lazy; }))
+            {
+                return false;
+            }
+
+            // lazy inputs are only required if they are demanded
+            if (!hasLazyInputs()) return true;
+
+            auto demanded = node->demandedInputs();
+            return inputsValid([&demanded](Node::PortInfo const& port){
+                return port.lazy && utils::contains(demanded, port.id());
+            });
+        }
+
+        bool hasLazyInputs() const
+        {
+            auto const& ports = node->ports(PortType::In);
+            return std::any_of(ports.begin(), ports.end(),
+                               [](Node::PortInfo const& port){
+                return port.lazy;
+            });
+        }
+
+        /// Returns the lazy input ports demanded by the node. Empty if the
+        /// non-lazy inputs are not valid yet, as the demand may depend on them.
+        std::vector<PortId> demandedInputs() const
+        {
+            if (!hasLazyInputs() ||
+                !inputsValid([](Node::PortInfo const& port){ return !port.lazy; }))
+            {
+                return {};
+            }
+
+            auto demanded = node->demandedInputs();
+            demanded.erase(std::remove_if(demanded.begin(), demanded.end(),
+                                          [this](PortId portId){
+                auto* port = node->port(portId);
+                return !port || !port->lazy;
+            }), demanded.end());
+            return demanded;
+        }
+
         bool isEvaluating() const
         {
             return utils::contains(execModel->pimpl->evaluatingNodes, node->uuid());
@@ -568,7 +894,7 @@ struct GraphExecutionModel::Impl
         // TODO: better solution?
         if (item.node->nodeEvalMode() != NodeEvalMode::ForwardInputsToOutputs)
         {
-            return invalidateNode(model, nodeUuid, item);
+            return invalidateNode(model, nodeUuid, item, portId);
         }
 
         // node is forwarding data from input to respective output
@@ -630,12 +956,61 @@ struct GraphExecutionModel::Impl
     invalidateNode(GraphExecutionModel& model,
                    NodeUuid const& nodeUuid,
                    MutableDataItemHelper item)
+    {
+        return invalidateNode(model, nodeUuid, item, [](PortId){
+            return true;
+        });
+    }
+
+    /**
+     * @brief Overload, that invalidates the node and only the output ports
+     * that depend on the input port `inPortId`. Only the successor nodes
+     * connected to these outputs are invalidated.
+     * @param model Model
+     * @param nodeUuid Node to update
+     * @param item Item
+     * @param inPortId Input port that changed
+     * @return success
+     */
+    static inline bool
+    invalidateNode(GraphExecutionModel& model,
+                   NodeUuid const& nodeUuid,
+                   MutableDataItemHelper item,
+                   PortId inPortId)
+    {
+        if (!item.node->hasPortDependencies())
+        {
+            return invalidateNode(model, nodeUuid, item);
+        }
+
+        auto outPorts = item.node->dependentOutPorts(inPortId);
+        return invalidateNode(model, nodeUuid, item, [&outPorts](PortId portId){
+            return utils::contains(outPorts, portId);
+        });
+    }
+
+    /**
+     * @brief Overload, that invalidates the node and all output ports
+     * for which `isAffected` returns true.
+     * @param model Model
+     * @param nodeUuid Node to update
+     * @param item Item
+     * @param isAffected Predicate accepting a port id of an output port
+     * @return success
+     */
+    template <typename Predicate>
+    static inline bool
+    invalidateNode(GraphExecutionModel& model,
+                   NodeUuid const& nodeUuid,
+                   MutableDataItemHelper item,
+                   Predicate isAffected)
     {
         if (item->state == NodeEvalState::Outdated &&
             std::all_of(item->portsOut.begin(),
                         item->portsOut.end(),
-                        [](auto const& port){
-                return port.data.state == PortDataState::Outdated;
+                        [&isAffected](auto const& port){
+                return port.data.state == PortDataState::Outdated ||
+                       !isAffected(port.portId);
             }))
         {
             // already invalidated -> nothing to do
@@ -648,24 +1023,39 @@ struct GraphExecutionModel::Impl
                    .arg(item.node->id());
 
         item->state = NodeEvalState::Outdated;
+        item->dataReleased = false;
 
         auto finally = gt::finally([node = item.node](){
             emit node->nodeEvalStateChanged();
         });
 
+        // the running evaluation is outdated and will be redone once finished
+        if (item.isEvaluating() &&
+            model.pimpl->cancelSupersededEvaluations &&
+            isNodeAutoEvaluating(model, nodeUuid) &&
+            exec::cancelEvaluation(*item.node))
+        {
+            INTELLI_LOG(model)
+                << tr("canceled superseded evaluation of node '%1' (%2)")
+                       .arg(relativeNodePath(*item.node))
+                       .arg(item.node->id());
+        }
+
         if (!item.isReadyForEvaluation())
         {
             utils::erase(model.pimpl->queuedNodes, nodeUuid);
         }
 
         bool success = true;
+        auto& conModel = model.graph().globalConnectionModel();
         for (auto& port : item->portsOut)
         {
+            if (!isAffected(port.portId)) continue;
+
             port.data.state = PortDataState::Outdated;
 
             // find and invalidate connected nodes
-            auto& conModel = model.graph().globalConnectionModel();
-            for (auto& con : conModel.iterate(nodeUuid, PortType::Out))
+            for (auto& con : conModel.iterate(nodeUuid, port.portId))
             {
                 success &= invalidatePort(model, con.node, con.port);
             }
@@ -690,6 +1080,14 @@ struct GraphExecutionModel::Impl
         if (item->state == NodeEvalState::Invalid) return;
 
         item->state = NodeEvalState::Invalid;
+        item->inputsModified = true;
+        item->dataReleased = false;
+
+        // subscribers are notified once the evaluation signal is emitted
+        if (model.pimpl->subscribers.contains(nodeUuid))
+        {
+            model.pimpl->failedNodes.push_back(nodeUuid);
+        }
 
         constexpr SetDataFlags flags = DontInvalidate | DontTriggerEvaluation;
 
@@ -784,15 +1182,20 @@ struct GraphExecutionModel::Impl
                    .arg(toString(data.ptr), relativeNodePath(*item.node))
                    .arg(portId);
 
+        bool isDataModified = !isEqual(item->data.ptr, data.ptr);
+        bool wasDataValid = item->data.state == PortDataState::Valid;
+
         item->data = std::move(data);
 
         switch (item.portType)
         {
         case PortType::In:
         {
+            if (isDataModified) item.entry->inputsModified = true;
+
             if (!(flags & DontInvalidate))
             {
-                invalidateNode(model, nodeUuid, item);
+                invalidateNode(model, nodeUuid, item, portId);
             }
 
             emit item.node->inputDataRecieved(portId);
@@ -835,9 +1238,25 @@ struct GraphExecutionModel::Impl
         }
         case PortType::Out:
         {
+            discardSpilledData(model, {nodeUuid, portId});
+            touchNodeData(model, {nodeUuid, portId});
+
             bool isInvalid = item.entry->state == NodeEvalState::Invalid;
             if (isInvalid) flags |= DontInvalidate;
 
+            // early cutoff: successors do not have to be invalidated if the
+            // data did not change
+            if (!isDataModified) flags |= DontInvalidate;
+
+            // released data is restored, the successors are still up-to-date
+            if (item.entry->dataReleased) flags |= DontInvalidate;
+
+            // output does not depend on the inputs that changed
+            if (wasDataValid && item.node->hasPortDependencies())
+            {
+                flags |= DontInvalidate;
+            }
+
             if (item.requiresReevaluation())
             {
                 item->data.state = PortDataState::Outdated;
@@ -877,6 +1296,43 @@ struct GraphExecutionModel::Impl
         }
     }
 
+    /// Overload that follows lazy input ports only if their data is demanded
+    /// by the node (see `Node::demandedInputs`).
+    template<typename List>
+    static void
+    accumulateDependencies(GraphExecutionModel& model,
+                           List& list,
+                           NodeUuid const& nodeUuid)
+    {
+        if (utils::contains(list, nodeUuid)) return;
+
+        auto& conModel = model.graph().globalConnectionModel();
+
+        auto item = findData(model, nodeUuid);
+        if (!item || !item.hasLazyInputs())
+        {
+            list.push_back(nodeUuid);
+            for (auto& nextNode : conModel.iterateNodes(nodeUuid, PortType::In))
+            {
+                accumulateDependencies(model, list, nextNode);
+            }
+            return;
+        }
+
+        list.push_back(nodeUuid);
+
+        auto demanded = item.demandedInputs();
+        for (auto const& port : item.node->ports(PortType::In))
+        {
+            if (port.lazy && !utils::contains(demanded, port.id())) continue;
+
+            for (auto& con : conModel.iterate(nodeUuid, port.id()))
+            {
+                accumulateDependencies(model, list, con.node);
+            }
+        }
+    }
+
     /// Sorts the given list according to topo sort, such that all nodes
     /// at the start of the list have no dependencies
     template <typename List>
@@ -905,108 +1361,671 @@ struct GraphExecutionModel::Impl
         nodes.erase(std::remove_if(nodes.begin(), nodes.end(), [&model](const auto& uuid) {
             auto item = findData(model, uuid, evaluteNodeError);
             assert(item);
-            return item.isEvaluated();
+            return item.isEvaluated() && !isReleasedDataRequired(model, uuid);
         }), nodes.end());
     }
 
     /**
-     * @brief Reschedules all target nodes and appends them to the list of
-     * pending nodes
+     * @brief Returns whether the node has to be reevaluated, because its data
+     * was released but is required by one of its successors.
      * @param model Exec model
-     * @return Whether any node was scheduled
+     * @param nodeUuid Node to check
+     * @return Whether the released data is required
      */
     static inline bool
-    rescheduleTargetNodes(GraphExecutionModel& model)
+    isReleasedDataRequired(GraphExecutionModel& model, NodeUuid const& nodeUuid)
     {
-        model.pimpl->pendingNodes.clear();
-
-        if (model.pimpl->targetNodes.empty()) return false;
+        auto item = findData(model, nodeUuid);
+        if (!item || !item->dataReleased) return false;
 
         auto& conModel = model.graph().globalConnectionModel();
-
-        // reschedule target nodes
-        for (NodeUuid const& nodeUuid : model.pimpl->targetNodes)
+        for (NodeUuid const& successor : conModel.iterateUniqueNodes(nodeUuid, PortType::Out))
         {
-            accumulateDependencies(conModel, model.pimpl->pendingNodes, nodeUuid);
-        }
-
-        sortDependencies(model, model.pimpl->pendingNodes);
-
-        removeEvaluatedNodes(model, model.pimpl->pendingNodes);
+            auto subitem = findData(model, successor);
+            if (!subitem) continue;
 
-        INTELLI_LOG(model) << "pending nodes:"
-                           << model.pimpl->pendingNodes;
+            if (!subitem.isEvaluated() ||
+                isReleasedDataRequired(model, successor)) return true;
+        }
+        return false;
+    }
 
-        return schedulePendingNodes(model);
+    /**
+     * @brief Returns the number of output ports of all nodes that hold data
+     * @param model Exec model
+     * @return Number of data objects
+     */
+    static inline size_t
+    countNodeData(GraphExecutionModel const& model)
+    {
+        size_t count = 0;
+        for (auto const& entry : model.pimpl->data)
+        {
+            for (auto const& port : entry.portsOut)
+            {
+                if (port.data.ptr) count++;
+            }
+        }
+        return count;
     }
 
     /**
-     * @brief Reschedules all graphs marked for auto evalaution and appends
-     * the nodes to the list of nodes to auto evaluate
+     * @brief Returns whether the output data of the node may be released, i.e.
+     * whether the node is evaluated, not pinned, not a target and all
+     * consumers have been evaluated. The data of graphs and nodes that forward
+     * their inputs is never released, as it is shared across graph boundaries.
      * @param model Exec model
-     * @return Whether any node was scheduled
+     * @param item Item referencing the node
+     * @return Whether the data can be released
      */
     static inline bool
-    rescheduleAutoEvaluatingNodes(GraphExecutionModel& model)
+    canReleaseNodeData(GraphExecutionModel& model, MutableDataItemHelper const& item)
     {
-        model.pimpl->autoEvaluatingNodes.clear();
+        assert(item);
 
-        if (model.pimpl->autoEvaluatingGraphs.empty()) return false;
+        auto const isForwarding = [](Node const& node){
+            return qobject_cast<Graph const*>(&node) ||
+                   node.nodeEvalMode() == NodeEvalMode::ForwardInputsToOutputs;
+        };
 
-        QVarLengthArray<NodeUuid, 20> targets;
+        NodeUuid const& nodeUuid = item.node->uuid();
 
-        // find all target nodes
-        for (NodeUuid const& graphUuid : model.pimpl->autoEvaluatingGraphs)
+        if (item->dataReleased ||
+            item->state != NodeEvalState::Valid ||
+            item.isEvaluating() ||
+            isForwarding(*item.node) ||
+            model.isNodeDataPinned(nodeUuid) ||
+            isNodeAutoEvaluating(model, nodeUuid) ||
+            utils::contains(model.pimpl->targetNodes, nodeUuid))
         {
-            Graph const* graph = qobject_cast<Graph const*>(model.graph().findNodeByUuid(graphUuid));
-            assert(graph);
-            findLeafNodes(*graph, targets);
-
-            // append the graph node itself
-            bool isRootGraph = model.pimpl->graph == graph;
-            if (!isRootGraph) targets.push_back(graphUuid);
+            return false;
         }
 
-        if (targets.empty()) return false;
-
         auto& conModel = model.graph().globalConnectionModel();
-
-        std::vector<NodeUuid> dummy;
-        // reschedule target nodes
-        for (NodeUuid const& nodeUuid : targets)
+        for (NodeUuid const& successor : conModel.iterateUniqueNodes(nodeUuid, PortType::Out))
         {
-            accumulateDependencies(conModel, dummy, nodeUuid);
+            auto subitem = findData(model, successor);
+            if (!subitem ||
+                !subitem.isEvaluated() ||
+                isForwarding(*subitem.node)) return false;
         }
-
-        model.pimpl->autoEvaluatingNodes = {dummy.begin(), dummy.end()};
-
-        return scheduleAutoEvaluatingNodes(model);
+        return true;
     }
 
     /**
-     * @brief Returns whether the given node should be auto evaluated.
-     * @param model Model
-     * @param nodeUuid Node to check
-     * @return Whether to auto evalauate the given node
+     * @brief Releases the output data of all predecessors of the given node,
+     * that is no longer required by any consumer. Output ports that are not
+     * connected are kept, as their data is not intermediate.
+     * @param model Exec model
+     * @param nodeUuid Node that was evaluated
      */
-    static inline bool
-    isNodeAutoEvaluating(GraphExecutionModel const& model,
-                       NodeUuid const& nodeUuid)
+    static inline void
+    releasePredecessorData(GraphExecutionModel& model, NodeUuid const& nodeUuid)
     {
-        return model.pimpl->autoEvaluatingNodes.find(nodeUuid) !=
-               model.pimpl->autoEvaluatingNodes.end();
+        auto& conModel = model.graph().globalConnectionModel();
+        for (NodeUuid const& predecessor : conModel.iterateUniqueNodes(nodeUuid, PortType::In))
+        {
+            auto item = findData(model, predecessor);
+            if (!item || !canReleaseNodeData(model, item)) continue;
+
+            auto conData = conModel.find(predecessor);
+            if (conData == conModel.end()) continue;
+
+            size_t released = 0;
+            for (auto& port : item->portsOut)
+            {
+                bool isSpilled = discardSpilledData(model, {predecessor, port.portId});
+
+                if ((!port.data.ptr && !isSpilled) ||
+                    !conData->hasConnections(port.portId, PortType::Out))
+                {
+                    continue;
+                }
+
+                // spilled data is no longer held in memory
+                if (port.data.ptr)
+                {
+                    model.pimpl->releasedNodeDataSize += port.data.ptr->byteSize();
+                }
+
+                port.data.ptr = nullptr;
+                port.data.state = PortDataState::Outdated;
+
+                // consumers share the same data object
+                for (auto& con : conModel.iterate(predecessor, port.portId))
+                {
+                    auto portItem = findPortData(model, con.node, con.port);
+                    if (!portItem) continue;
+
+                    portItem->data.ptr = nullptr;
+                    portItem->data.state = PortDataState::Outdated;
+                }
+                released++;
+            }
+
+            if (released == 0) continue;
+
+            INTELLI_LOG(model)
+                << tr("released data of node '%1' (%2)")
+                       .arg(relativeNodePath(*item.node))
+                       .arg(item.node->id());
+
+            item->dataReleased = true;
+            model.pimpl->releasedNodeDataCount += released;
+        }
     }
 
     /**
-     * @brief Auto evaluates the specified graph such that all dependencies
-     * required for the evaluation of the leaf nodes of the specified graph are
-     * marked for auto evaluation and are kept up-to-date.
+     * @brief Returns the output port that provides the data of the given port.
+     * For input ports the output port of the connected node is returned.
      * @param model Exec model
-     * @return success
+     * @param node Node
+     * @param portId Input or output port
+     * @return Output port (the node uuid is empty if no port was found)
      */
-    static inline bool
-    autoEvaluateGraph(GraphExecutionModel& model,
-                      Graph& graph)
+    static inline PortKey
+    sourcePort(GraphExecutionModel const& model,
+               Node const& node,
+               PortId portId)
+    {
+        switch (node.portType(portId))
+        {
+        case PortType::Out:
+            return {node.uuid(), portId};
+        case PortType::In:
+        {
+            auto& conModel = model.graph().globalConnectionModel();
+            for (auto& con : conModel.iterate(node.uuid(), portId))
+            {
+                return {con.node, con.port};
+            }
+            break;
+        }
+        case PortType::NoType:
+            break;
+        }
+        return {};
+    }
+
+    /**
+     * @brief Returns whether the data of the given port was spilled to disk
+     * @param model Exec model
+     * @param node Node
+     * @param portId Input or output port
+     * @return Is spilled
+     */
+    static inline bool
+    isNodeDataSpilled(GraphExecutionModel const& model,
+                      Node const& node,
+                      PortId portId)
+    {
+        auto const& spilledData = model.pimpl->spilledData;
+        if (spilledData.empty()) return false;
+
+        return spilledData.find(sourcePort(model, node, portId)) !=
+               spilledData.end();
+    }
+
+    /**
+     * @brief Marks the data of the output port as recently used
+     * @param model Exec model
+     * @param key Output port
+     */
+    static inline void
+    touchNodeData(GraphExecutionModel& model, PortKey const& key)
+    {
+        // accesses are only tracked if data may be spilled
+        if (key.first.isEmpty() || model.pimpl->memoryBudget == 0) return;
+
+        model.pimpl->dataAccess[key] = ++model.pimpl->accessCounter;
+    }
+
+    /**
+     * @brief Removes the spilled data of the output port from disk
+     * @param model Exec model
+     * @param key Output port
+     * @return Whether the data was spilled
+     */
+    static inline bool
+    discardSpilledData(GraphExecutionModel& model, PortKey const& key)
+    {
+        auto& spilledData = model.pimpl->spilledData;
+        auto iter = spilledData.find(key);
+        if (iter == spilledData.end()) return false;
+
+        QFile::remove(iter->second.filePath);
+        spilledData.erase(iter);
+        return true;
+    }
+
+    /**
+     * @brief Removes the spilled data of all output ports of the node from
+     * disk and forgets when the data was last accessed
+     * @param model Exec model
+     * @param nodeUuid Node
+     */
+    static inline void
+    discardSpilledNodeData(GraphExecutionModel& model, NodeUuid const& nodeUuid)
+    {
+        auto& spilledData = model.pimpl->spilledData;
+        for (auto iter = spilledData.begin(); iter != spilledData.end();)
+        {
+            if (iter->first.first != nodeUuid) ++iter;
+            else
+            {
+                QFile::remove(iter->second.filePath);
+                iter = spilledData.erase(iter);
+            }
+        }
+
+        auto& dataAccess = model.pimpl->dataAccess;
+        for (auto iter = dataAccess.begin(); iter != dataAccess.end();)
+        {
+            if (iter->first.first == nodeUuid) iter = dataAccess.erase(iter);
+            else ++iter;
+        }
+    }
+
+    /**
+     * @brief Returns the approximate number of bytes of all node data held in
+     * memory (see `NodeData::byteSize`). Data that is shared by multiple
+     * ports is only counted once.
+     * @param model Exec model
+     * @return Size in bytes
+     */
+    static inline size_t
+    memoryUsage(GraphExecutionModel const& model)
+    {
+        std::set<NodeData const*> visited;
+
+        size_t size = 0;
+        for (auto const& entry : model.pimpl->data)
+        {
+            for (auto const& port : entry.portsOut)
+            {
+                NodeData const* data = port.data.ptr.get();
+                if (!data || !visited.insert(data).second) continue;
+
+                size += data->byteSize();
+            }
+        }
+        return size;
+    }
+
+    /**
+     * @brief Returns the directory in which spilled data is stored. The
+     * directory is created on demand and removed together with the model.
+     * @param model Exec model
+     * @return Directory (null if the directory could not be created)
+     */
+    static inline QTemporaryDir*
+    spillDirectory(GraphExecutionModel& model)
+    {
+        auto& dir = model.pimpl->spillDir;
+        if (!dir)
+        {
+            QString path = model.pimpl->spillDirectory;
+            if (path.isEmpty()) path = QDir::tempPath();
+
+            dir = std::make_unique<QTemporaryDir>(
+                QDir(path).filePath(QStringLiteral("intelli_spill_XXXXXX"))
+            );
+
+            if (!dir->isValid())
+            {
+                gtWarning()
+                    << utils::logId(model.graph())
+                    << tr("Failed to create spill directory in '%1'! (%2)")
+                           .arg(path, dir->errorString());
+            }
+        }
+
+        return dir->isValid() ? dir.get() : nullptr;
+    }
+
+    /**
+     * @brief Writes the data of the output port to disk and releases the data
+     * of the port and of all connected input ports.
+     * @param model Exec model
+     * @param key Output port
+     * @return success
+     */
+    static inline bool
+    spillNodeData(GraphExecutionModel& model, PortKey const& key)
+    {
+        auto item = findPortData(model, key.first, key.second);
+        if (!item || !item->data.ptr) return false;
+
+        QByteArray bytes;
+        {
+            QDataStream stream(&bytes, QIODevice::WriteOnly);
+            if (!NodeDataFactory::instance().serialize(item->data.ptr, stream))
+            {
+                return false;
+            }
+        }
+
+        bool compress = model.pimpl->compressSpilledData;
+        if (compress) bytes = qCompress(bytes);
+
+        QTemporaryDir* dir = spillDirectory(model);
+        if (!dir) return false;
+
+        QString fileName = QString::number(++model.pimpl->spillCounter) +
+                           QStringLiteral(".spill");
+
+        QFile file(dir->filePath(fileName));
+        if (!file.open(QFile::WriteOnly | QFile::Truncate) ||
+            file.write(bytes) != bytes.size())
+        {
+            gtWarning()
+                << utils::logId(model.graph())
+                << tr("Failed to spill data of node '%1' to '%2'! (%3)")
+                       .arg(relativeNodePath(*item.node),
+                            file.fileName(),
+                            file.errorString());
+            file.remove();
+            return false;
+        }
+
+        INTELLI_LOG(model)
+            << tr("spilled data of node '%1' (%2), port %3 to disk")
+                   .arg(relativeNodePath(*item.node))
+                   .arg(item.node->id())
+                   .arg(key.second);
+
+        item->data.ptr = nullptr;
+
+        // consumers share the same data object
+        auto& conModel = model.graph().globalConnectionModel();
+        for (auto& con : conModel.iterate(key.first, key.second))
+        {
+            auto portItem = findPortData(model, con.node, con.port);
+            if (portItem) portItem->data.ptr = nullptr;
+        }
+
+        model.pimpl->spilledData[key] = { file.fileName(), compress };
+        return true;
+    }
+
+    /**
+     * @brief Reads the spilled data of the output port from disk. The model
+     * is not altered, i.e. the data remains spilled.
+     * @param model Exec model
+     * @param key Output port
+     * @return Data (null if the data was not spilled or could not be read)
+     */
+    static inline NodeDataPtr
+    loadSpilledData(GraphExecutionModel const& model, PortKey const& key)
+    {
+        auto const& spilledData = model.pimpl->spilledData;
+        auto iter = spilledData.find(key);
+        if (iter == spilledData.end()) return {};
+
+        SpilledData const& spilled = iter->second;
+
+        QFile file(spilled.filePath);
+        QByteArray bytes;
+        if (file.open(QFile::ReadOnly)) bytes = file.readAll();
+        if (spilled.compressed) bytes = qUncompress(bytes);
+
+        QDataStream stream(bytes);
+        auto data = NodeDataFactory::instance().deserialize(stream);
+        if (!data || !*data)
+        {
+            gtError()
+                << utils::logId(model.graph())
+                << tr("Failed to restore spilled data of node '%1' from '%2'!")
+                       .arg(key.first, spilled.filePath);
+            return {};
+        }
+
+        return *data;
+    }
+
+    /**
+     * @brief Restores the spilled data of the given port. For input ports
+     * the data of the connected output port is restored. If the data cannot
+     * be read, it is lost and the source node is invalidated.
+     * @param model Exec model
+     * @param item Item referencing the input or output port
+     * @return Whether the data was restored
+     */
+    static inline bool
+    restoreNodeData(GraphExecutionModel& model,
+                    MutablePortDataItemHelper const& item)
+    {
+        assert(item);
+
+        auto& spilledData = model.pimpl->spilledData;
+        if (spilledData.empty()) return false;
+
+        PortKey key = sourcePort(model, *item.node, item->portId);
+
+        auto iter = spilledData.find(key);
+        if (iter == spilledData.end()) return false;
+
+        NodeDataPtr data = loadSpilledData(model, key);
+
+        QFile::remove(iter->second.filePath);
+        spilledData.erase(iter);
+
+        auto source = findPortData(model, key.first, key.second);
+        if (!source) return false;
+
+        if (!data)
+        {
+            // data is lost, the node has to be reevaluated even if its inputs
+            // did not change
+            model.invalidateNode(key.first);
+            return false;
+        }
+
+        source->data.ptr = data;
+
+        auto& conModel = model.graph().globalConnectionModel();
+        for (auto& con : conModel.iterate(key.first, key.second))
+        {
+            auto portItem = findPortData(model, con.node, con.port);
+            if (portItem) portItem->data.ptr = data;
+        }
+
+        touchNodeData(model, key);
+        return true;
+    }
+
+    /**
+     * @brief Restores the spilled input data of the node before it is
+     * evaluated and marks its inputs as recently used.
+     * @param model Exec model
+     * @param item Item referencing the node
+     * @return Whether all spilled inputs were restored
+     */
+    static inline bool
+    restoreInputData(GraphExecutionModel& model, MutableDataItemHelper& item)
+    {
+        if (model.pimpl->memoryBudget == 0 && model.pimpl->spilledData.empty())
+        {
+            return true;
+        }
+
+        bool success = true;
+        for (auto const& port : item->portsIn)
+        {
+            PortId portId = port.portId;
+            if (!port.data.ptr && isNodeDataSpilled(model, *item.node, portId))
+            {
+                auto portItem = findPortData(model, item, portId);
+                success &= portItem && restoreNodeData(model, portItem);
+                continue;
+            }
+
+            touchNodeData(model, sourcePort(model, *item.node, portId));
+        }
+        return success;
+    }
+
+    /**
+     * @brief Spills the least recently used node data to disk until the
+     * memory usage is within the memory budget. Only data that is not
+     * referenced elsewhere (e.g. by a running evaluation or a node that
+     * forwards its inputs) is spilled, as its memory would not be freed
+     * otherwise.
+     * @param model Exec model
+     */
+    static inline void
+    enforceMemoryBudget(GraphExecutionModel& model)
+    {
+        size_t budget = model.pimpl->memoryBudget;
+        if (budget == 0) return;
+
+        size_t usage = memoryUsage(model);
+        if (usage <= budget) return;
+
+        struct Candidate
+        {
+            PortKey key;
+            quint64 lastAccess;
+            size_t size;
+        };
+
+        std::vector<Candidate> candidates;
+
+        auto& conModel = model.graph().globalConnectionModel();
+        for (auto iter = model.pimpl->data.begin();
+             iter != model.pimpl->data.end(); ++iter)
+        {
+            NodeUuid const& nodeUuid = iter.key();
+            if (utils::contains(model.pimpl->evaluatingNodes, nodeUuid)) continue;
+
+            for (auto const& port : iter->portsOut)
+            {
+                auto const& ptr = port.data.ptr;
+                if (!ptr) continue;
+
+                size_t size = ptr->byteSize();
+                if (size == 0) continue;
+
+                // the data is only referenced by this port and its consumers
+                auto refs = 1 + conModel.iterate(nodeUuid, port.portId).size();
+                if ((size_t)ptr.use_count() > refs) continue;
+
+                PortKey key{nodeUuid, port.portId};
+                auto access = model.pimpl->dataAccess.find(key);
+                quint64 lastAccess = access != model.pimpl->dataAccess.end() ?
+                                         access->second : 0;
+
+                candidates.push_back({std::move(key), lastAccess, size});
+            }
+        }
+
+        std::sort(candidates.begin(), candidates.end(),
+                  [](Candidate const& a, Candidate const& b){
+            return a.lastAccess < b.lastAccess;
+        });
+
+        for (Candidate const& candidate : candidates)
+        {
+            if (usage <= budget) break;
+
+            if (spillNodeData(model, candidate.key)) usage -= candidate.size;
+        }
+    }
+
+    /**
+     * @brief Reschedules all target nodes and appends them to the list of
+     * pending nodes
+     * @param model Exec model
+     * @return Whether any node was scheduled
+     */
+    static inline bool
+    rescheduleTargetNodes(GraphExecutionModel& model)
+    {
+        model.pimpl->pendingNodes.clear();
+
+        if (model.pimpl->targetNodes.empty()) return false;
+
+        // reschedule target nodes
+        for (NodeUuid const& nodeUuid : model.pimpl->targetNodes)
+        {
+            accumulateDependencies(model, model.pimpl->pendingNodes, nodeUuid);
+        }
+
+        sortDependencies(model, model.pimpl->pendingNodes);
+
+        removeEvaluatedNodes(model, model.pimpl->pendingNodes);
+
+        INTELLI_LOG(model) << "pending nodes:"
+                           << model.pimpl->pendingNodes;
+
+        return schedulePendingNodes(model);
+    }
+
+    /**
+     * @brief Reschedules all graphs marked for auto evalaution and appends
+     * the nodes to the list of nodes to auto evaluate
+     * @param model Exec model
+     * @return Whether any node was scheduled
+     */
+    static inline bool
+    rescheduleAutoEvaluatingNodes(GraphExecutionModel& model)
+    {
+        model.pimpl->autoEvaluatingNodes.clear();
+
+        if (model.pimpl->autoEvaluatingGraphs.empty()) return false;
+
+        QVarLengthArray<NodeUuid, 20> targets;
+
+        // find all target nodes
+        for (NodeUuid const& graphUuid : model.pimpl->autoEvaluatingGraphs)
+        {
+            Graph const* graph = qobject_cast<Graph const*>(model.graph().findNodeByUuid(graphUuid));
+            assert(graph);
+            findLeafNodes(*graph, targets);
+
+            // append the graph node itself
+            bool isRootGraph = model.pimpl->graph == graph;
+            if (!isRootGraph) targets.push_back(graphUuid);
+        }
+
+        if (targets.empty()) return false;
+
+        std::vector<NodeUuid> dummy;
+        // reschedule target nodes
+        for (NodeUuid const& nodeUuid : targets)
+        {
+            accumulateDependencies(model, dummy, nodeUuid);
+        }
+
+        model.pimpl->autoEvaluatingNodes = {dummy.begin(), dummy.end()};
+
+        return scheduleAutoEvaluatingNodes(model);
+    }
+
+    /**
+     * @brief Returns whether the given node should be auto evaluated.
+     * @param model Model
+     * @param nodeUuid Node to check
+     * @return Whether to auto evalauate the given node
+     */
+    static inline bool
+    isNodeAutoEvaluating(GraphExecutionModel const& model,
+                       NodeUuid const& nodeUuid)
+    {
+        return model.pimpl->autoEvaluatingNodes.find(nodeUuid) !=
+               model.pimpl->autoEvaluatingNodes.end();
+    }
+
+    /**
+     * @brief Auto evaluates the specified graph such that all dependencies
+     * required for the evaluation of the leaf nodes of the specified graph are
+     * marked for auto evaluation and are kept up-to-date.
+     * @param model Exec model
+     * @return success
+     */
+    static inline bool
+    autoEvaluateGraph(GraphExecutionModel& model,
+                      Graph& graph)
     {
         if (!model.isAutoEvaluatingGraph(graph))
         {
@@ -1099,7 +2118,7 @@ struct GraphExecutionModel::Impl
         {
             INTELLI_LOG(model)
                 << tr("node is not ready for evaluation!");
-            return false;
+            return scheduleAutoEvaluationOfDemandedInputs(model, nodeUuid);
         }
 
         if (item.isQueued())
@@ -1137,6 +2156,22 @@ struct GraphExecutionModel::Impl
         bool isRootGraph = model.pimpl->graph == &graph;
         if (!isRootGraph) targets.push_back(graph.uuid());
 
+        return evaluateNodes(model, targets);
+    }
+
+    /**
+     * @brief Evaluates the specified target nodes such that only the
+     * dependencies that are required for the evaluation of the target nodes
+     * are evaluated exactly once (demand-driven evaluation).
+     * @param model Exec model
+     * @param targets Target nodes
+     * @return Future object
+     */
+    template <typename List>
+    static inline ExecFuture
+    evaluateNodes(GraphExecutionModel& model,
+                  List const& targets)
+    {
         // evaluate pending nodes
         ExecFuture future{model};
 
@@ -1162,11 +2197,47 @@ struct GraphExecutionModel::Impl
             future.append(nodeUuid);
         }
 
-        rescheduleTargetNodes(model);
+        rescheduleTargetNodes(model);
+
+        evaluateNextInQueue(model);
+
+        return future;
+    }
+
+    /**
+     * @brief Evaluates all sink nodes of the specified graph and its subgraphs
+     * including the output provider of the graph. Falls back to evaluating
+     * the entire graph if the graph has no sink nodes.
+     * @param model Exec model
+     * @param graph Graph to evaluate
+     * @return Future object
+     */
+    static inline ExecFuture
+    evaluateSinks(GraphExecutionModel& model,
+                  Graph const& graph)
+    {
+        assert(containsGraph(model, graph));
+
+        INTELLI_LOG_SCOPE(model)
+            << QObject::tr("evaluating sinks of graph '%1'...")
+                   .arg(relativeNodePath(graph));
+
+        std::vector<NodeUuid> targets;
+        findSinkNodes(graph, targets);
+
+        if (targets.empty())
+        {
+            INTELLI_LOG(model)
+                << QObject::tr("no sink nodes found!");
+            return evaluateGraph(model, graph);
+        }
 
-        evaluateNextInQueue(model);
+        if (auto* provider = graph.outputProvider())
+        {
+            targets.push_back(provider->uuid());
+        }
 
-        return future;
+        return evaluateNodes(model, targets);
     }
 
     /**
@@ -1242,7 +2313,8 @@ struct GraphExecutionModel::Impl
                 << tr("attempting to queue node '%1'...")
                        .arg(relativeNodePath(*item.node));
 
-            if (item.isEvaluated())
+            if (item.isEvaluated() &&
+                !isReleasedDataRequired(model, nodeUuid))
             {
                 INTELLI_LOG(model)
                     << tr("node is already evaluated!");
@@ -1258,10 +2330,19 @@ struct GraphExecutionModel::Impl
 
             if (!item.isReadyForEvaluation())
             {
+                removeFromPending.clear();
+
+                // copy, as list of pending nodes may be altered
+                NodeUuid uuid = nodeUuid;
+                if (schedulePendingDemandedInputs(model, uuid))
+                {
+                    // restart, as list was resorted
+                    idx = std::numeric_limits<size_t>::max();
+                    continue;
+                }
+
                 INTELLI_LOG(model)
                     << tr("node is not ready for evaluation!");
-
-                removeFromPending.clear();
                 break;
             }
 
@@ -1280,6 +2361,111 @@ struct GraphExecutionModel::Impl
         return (after - before) > 0;
     }
 
+    /**
+     * @brief Accumulates the dependencies of the lazy input ports, that are
+     * demanded by the given node, but are not evaluated nor scheduled yet.
+     * @param model Exec model
+     * @param nodeUuid Node, whose demanded inputs should be evaluated
+     * @param scheduled Nodes that are already scheduled
+     * @return Dependencies of the demanded inputs (not sorted)
+     */
+    template <typename List>
+    static inline std::vector<NodeUuid>
+    findDemandedDependencies(GraphExecutionModel& model,
+                             NodeUuid const& nodeUuid,
+                             List const& scheduled)
+    {
+        auto item = findData(model, nodeUuid);
+        if (!item) return {};
+
+        auto demanded = item.demandedInputs();
+        if (demanded.empty()) return {};
+
+        auto& conModel = model.graph().globalConnectionModel();
+
+        std::vector<NodeUuid> dependencies;
+        for (PortId portId : demanded)
+        {
+            for (auto& con : conModel.iterate(nodeUuid, portId))
+            {
+                accumulateDependencies(model, dependencies, con.node);
+            }
+        }
+
+        dependencies.erase(std::remove_if(dependencies.begin(), dependencies.end(),
+                                          [&model, &scheduled](NodeUuid const& uuid){
+            if (utils::contains(scheduled, uuid)) return true;
+            auto dependency = findData(model, uuid);
+            return !dependency ||
+                   (dependency.isEvaluated() &&
+                    !isReleasedDataRequired(model, uuid)) ||
+                   dependency.isEvaluating() ||
+                   dependency.isQueued();
+        }), dependencies.end());
+
+        return dependencies;
+    }
+
+    /**
+     * @brief Appends the dependencies of the lazy input ports, that are
+     * demanded by the given node, to the list of pending nodes.
+     * @param model Exec model
+     * @param nodeUuid Pending node, that is not ready for evaluation
+     * @return Whether any pending node was added
+     */
+    static inline bool
+    schedulePendingDemandedInputs(GraphExecutionModel& model,
+                                  NodeUuid const& nodeUuid)
+    {
+        auto& pendingNodes = model.pimpl->pendingNodes;
+
+        auto dependencies =
+            findDemandedDependencies(model, nodeUuid, pendingNodes);
+        if (dependencies.empty()) return false;
+
+        INTELLI_LOG(model)
+            << tr("scheduling demanded inputs of node '%1':").arg(nodeUuid)
+            << dependencies;
+
+        pendingNodes.insert(pendingNodes.end(),
+                            dependencies.begin(), dependencies.end());
+        sortDependencies(model, pendingNodes);
+        return true;
+    }
+
+    /**
+     * @brief Marks the dependencies of the lazy input ports, that are demanded
+     * by the given node, for auto evaluation and schedules them.
+     * @param model Exec model
+     * @param nodeUuid Auto evaluating node, that is not ready for evaluation
+     * @return Whether any node was scheduled
+     */
+    static inline bool
+    scheduleAutoEvaluationOfDemandedInputs(GraphExecutionModel& model,
+                                           NodeUuid const& nodeUuid)
+    {
+        auto& autoEvaluatingNodes = model.pimpl->autoEvaluatingNodes;
+
+        auto dependencies =
+            findDemandedDependencies(model, nodeUuid, autoEvaluatingNodes);
+        if (dependencies.empty()) return false;
+
+        INTELLI_LOG(model)
+            << tr("scheduling demanded inputs of node '%1' for auto evaluation:")
+                   .arg(nodeUuid)
+            << dependencies;
+
+        autoEvaluatingNodes.insert(dependencies.begin(), dependencies.end());
+        sortDependencies(model, dependencies);
+
+        bool success = false;
+        for (NodeUuid const& dependency : dependencies)
+        {
+            success |= scheduleForAutoEvaluation(model, dependency);
+        }
+        return success;
+    }
+
     /**
      * @brief Schedules all nodes that are marked for auto evaluation but
      * does not trigger their evaluation.
@@ -1315,6 +2501,49 @@ struct GraphExecutionModel::Impl
         return success;
     }
 
+    /**
+     * @brief Returns whether the evaluation of the node can be skipped, i.e.
+     * whether the node was only invalidated by one of its predecessors, but
+     * its inputs did not change (early cutoff).
+     * @param item Item referencing the node
+     * @return Whether the evaluation can be skipped
+     */
+    static inline bool
+    canSkipEvaluation(MutableDataItemHelper const& item)
+    {
+        assert(item);
+
+        // subgraphs are evaluated as their inner nodes may be outdated
+        if (qobject_cast<Graph const*>(item.node)) return false;
+
+        return item->state == NodeEvalState::Outdated &&
+               !item->inputsModified;
+    }
+
+    /**
+     * @brief Computes the key of the node in the result cache, if the node is
+     * cacheable.
+     * @param model Exec model
+     * @param item Item referencing the node
+     * @return Cache key (empty if the node should not be cached)
+     */
+    static inline QByteArray
+    resultCacheKey(GraphExecutionModel& model,
+                   MutableDataItemHelper const& item)
+    {
+        assert(item);
+
+        if (!model.pimpl->resultCache ||
+            !(item.node->nodeFlags() & NodeFlag::Cacheable))
+        {
+            return {};
+        }
+
+        NodeUuid const& nodeUuid = item.node->uuid();
+        return NodeResultCache::key(*item.node,
+                                    model.nodeData(nodeUuid, PortType::In));
+    }
+
     /**
      * @brief Tries to evalaute the specified node.
      * @param model Exec model
@@ -1348,6 +2577,37 @@ struct GraphExecutionModel::Impl
             return NodeEvalState::Paused;
         }
 
+        NodeUuid const& nodeUuid = item.node->uuid();
+
+        if (canSkipEvaluation(item))
+        {
+            INTELLI_LOG_SCOPE(model)
+                << tr("inputs of node '%1' did not change, skipping evaluation...")
+                       .arg(relativeNodePath(*item.node));
+
+            model.pimpl->queuedNodes.erase(iter);
+            nodeRemovedFromQueue = true;
+
+            // outputs are still up-to-date
+            model.nodeEvaluationStarted(nodeUuid);
+            model.nodeEvaluationFinished(nodeUuid);
+
+            return NodeEvalState::Valid;
+        }
+
+        // spilled inputs are restored before the node accesses them
+        if (!restoreInputData(model, item))
+        {
+            INTELLI_LOG(model)
+                << tr("failed to restore inputs of node '%1'!")
+                       .arg(relativeNodePath(*item.node));
+
+            // dequeue, the predecessors have to be reevaluated
+            model.pimpl->queuedNodes.erase(iter);
+            nodeRemovedFromQueue = true;
+            return NodeEvalState::Outdated;
+        }
+
         // check if this model has
         bool isExclusiveNodeRunning =
             std::any_of(model.pimpl->evaluatingNodes.cbegin(),
@@ -1366,6 +2626,10 @@ struct GraphExecutionModel::Impl
             return NodeEvalState::Paused;
         }
 
+        // resources may depend on the input data, thus they are determined
+        // before each evaluation
+        NodeResources resources = s_sync.normalized(item.node->resources());
+
         bool isExclusive = item.isExclusive();
         if (isExclusive && !model.pimpl->evaluatingNodes.empty())
         {
@@ -1394,6 +2658,18 @@ struct GraphExecutionModel::Impl
                 return NodeEvalState::Paused;
             }
 
+            // only nodes contending for the same resources are serialized,
+            // thus other queued nodes may still be evaluated
+            if (!s_sync.canAcquire(resources))
+            {
+                INTELLI_LOG(model)
+                    << tr("node '%1' must wait for its resources!")
+                           .arg(relativeNodePath(*item.node));
+                return NodeEvalState::Outdated;
+            }
+
+            s_sync.acquire(model, nodeUuid, std::move(resources));
+
             // update synchronization entitiy
             auto idx = s_sync.indexOf(model);
             assert(idx >= 0);
@@ -1402,16 +2678,46 @@ struct GraphExecutionModel::Impl
             entry.isExclusiveNodeRunning = isExclusive;
         }
 
+        QByteArray cacheKey = resultCacheKey(model, item);
+
+        // the results are loaded instead of evaluating the node
+        if (!cacheKey.isEmpty())
+        {
+            if (auto data = model.pimpl->resultCache->load(cacheKey))
+            {
+                INTELLI_LOG_SCOPE(model)
+                    << tr("loading results of node '%1' from cache...")
+                           .arg(relativeNodePath(*item.node));
+
+                model.pimpl->queuedNodes.erase(iter);
+                nodeRemovedFromQueue = true;
+
+                // releases the acquired resources once finished
+                model.nodeEvaluationStarted(nodeUuid);
+                if (!model.setNodeData(nodeUuid, PortType::Out, *data))
+                {
+                    model.setNodeEvaluationFailed(nodeUuid);
+                }
+                model.nodeEvaluationFinished(nodeUuid);
+
+                return item->state;
+            }
+        }
+
         INTELLI_LOG_SCOPE(model)
             << tr("triggering evaluation of node '%1'...")
                    .arg(relativeNodePath(*item.node));
 
-        NodeUuid const& nodeUuid = item.node->uuid();
-
         // dequeue and mark as evaluating
         model.pimpl->queuedNodes.erase(iter);
         nodeRemovedFromQueue = true;
 
+        // results are stored once the node was evaluated successfully
+        if (!cacheKey.isEmpty())
+        {
+            model.pimpl->cacheKeys.insert(nodeUuid, std::move(cacheKey));
+        }
+
         assert(exec::nodeDataInterface(*item.node) == &model);
 
         // trigger node evaluation
@@ -1435,6 +2741,10 @@ struct GraphExecutionModel::Impl
                 s_sync.notify(model);
             }
 
+            s_sync.release(model, nodeUuid);
+
+            model.pimpl->cacheKeys.remove(nodeUuid);
+
             propagateNodeEvaluationFailure(model, nodeUuid, item);
 
             return NodeEvalState::Invalid;
@@ -1443,6 +2753,305 @@ struct GraphExecutionModel::Impl
         return item->state;
     }
 
+    /**
+     * @brief Returns the debounce window of the given node
+     * @param model Exec model
+     * @param nodeUuid Node
+     * @return Debounce window (zero if disabled)
+     */
+    static inline std::chrono::milliseconds
+    debounceInterval(GraphExecutionModel const& model,
+                     NodeUuid const& nodeUuid)
+    {
+        auto iter = model.pimpl->nodeDebounceIntervals.find(nodeUuid);
+        if (iter != model.pimpl->nodeDebounceIntervals.end()) return *iter;
+
+        return model.pimpl->debounceInterval;
+    }
+
+    /**
+     * @brief Defers the auto evaluation of the triggered node until its
+     * debounce window has passed without another trigger. Triggers within the
+     * window are coalesced, the node is evaluated using the latest values.
+     * @param model Exec model
+     * @param nodeUuid Node that was triggered
+     * @return Whether the auto evaluation was deferred
+     */
+    static inline bool
+    debounceAutoEvaluation(GraphExecutionModel& model,
+                           NodeUuid const& nodeUuid)
+    {
+        auto interval = debounceInterval(model, nodeUuid);
+        if (interval.count() <= 0) return false;
+
+        INTELLI_LOG(model)
+            << tr("deferring auto evaluation of node '%1' by %2 ms...")
+                   .arg(nodeUuid)
+                   .arg(interval.count());
+
+        model.pimpl->debouncedNodes[nodeUuid] =
+            std::chrono::steady_clock::now() + interval;
+
+        restartDebounceTimer(model);
+        return true;
+    }
+
+    /**
+     * @brief Restarts the debounce timer such that it fires once the next
+     * debounced node is due.
+     * @param model Exec model
+     */
+    static inline void
+    restartDebounceTimer(GraphExecutionModel& model)
+    {
+        auto& nodes = model.pimpl->debouncedNodes;
+        if (nodes.empty()) return model.pimpl->debounceTimer.stop();
+
+        auto next = std::min_element(nodes.begin(), nodes.end(),
+                                     [](auto const& a, auto const& b){
+            return a.second < b.second;
+        })->second;
+
+        // round up to avoid firing before the node is due
+        using namespace std::chrono;
+        auto remaining = duration_cast<milliseconds>(
+            next - steady_clock::now() + milliseconds(1) - nanoseconds(1)
+        );
+        model.pimpl->debounceTimer.start(std::max(0, (int)remaining.count()));
+    }
+
+    /**
+     * @brief Auto evaluates all debounced nodes whose window has passed in a
+     * single scheduling pass.
+     * @param model Exec model
+     * @return Whether any node was scheduled
+     */
+    static inline bool
+    autoEvaluateDebouncedNodes(GraphExecutionModel& model)
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        std::vector<NodeUuid> dueNodes;
+        auto& nodes = model.pimpl->debouncedNodes;
+        for (auto iter = nodes.begin(); iter != nodes.end();)
+        {
+            if (iter->second > now)
+            {
+                ++iter;
+                continue;
+            }
+            dueNodes.push_back(iter->first);
+            iter = nodes.erase(iter);
+        }
+
+        restartDebounceTimer(model);
+
+        // outdated nodes are rescheduled once the modification ends
+        if (model.isBeingModified()) return false;
+
+        bool scheduled = false;
+        for (NodeUuid const& nodeUuid : dueNodes)
+        {
+            if (isNodeAutoEvaluating(model, nodeUuid))
+            {
+                scheduled |= scheduleForAutoEvaluation(model, nodeUuid);
+            }
+        }
+
+        if (scheduled) evaluateNextInQueue(model);
+
+        return scheduled;
+    }
+
+    /**
+     * @brief Subscribes to the completion of the target nodes. Only targets
+     * that have not been evaluated yet are tracked, such that the evaluation
+     * of a node only touches the subscriptions waiting for it.
+     * @param model Exec model
+     * @param targets Target nodes
+     * @param callback Callback, may be invoked immediately
+     * @return Subscription id
+     */
+    static inline size_t
+    subscribe(GraphExecutionModel& model,
+              std::vector<NodeUuid> targets,
+              CompletionCallback callback)
+    {
+        std::sort(targets.begin(), targets.end());
+        targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+        size_t id = ++model.pimpl->lastSubscription;
+
+        Subscription subscription{std::move(targets), 0, std::move(callback)};
+
+        for (NodeUuid const& nodeUuid : subscription.targets)
+        {
+            switch (model.nodeEvalState(nodeUuid))
+            {
+            case NodeEvalState::Valid:
+                continue;
+            case NodeEvalState::Invalid:
+                if (subscription.callback) subscription.callback(false);
+                return id;
+            default:
+                break;
+            }
+        }
+
+        for (NodeUuid const& nodeUuid : subscription.targets)
+        {
+            if (model.nodeEvalState(nodeUuid) == NodeEvalState::Valid) continue;
+
+            model.pimpl->subscribers[nodeUuid].push_back(id);
+            subscription.remaining++;
+        }
+
+        if (subscription.remaining == 0)
+        {
+            if (subscription.callback) subscription.callback(true);
+            return id;
+        }
+
+        model.pimpl->subscriptions.insert({id, std::move(subscription)});
+        return id;
+    }
+
+    /**
+     * @brief Removes the subscription without invoking its callback.
+     * @param model Exec model
+     * @param id Subscription id
+     * @return Callback of the subscription (null if the subscription was not
+     * found)
+     */
+    static inline CompletionCallback
+    unsubscribe(GraphExecutionModel& model, size_t id)
+    {
+        auto& subscriptions = model.pimpl->subscriptions;
+        auto iter = subscriptions.find(id);
+        if (iter == subscriptions.end()) return {};
+
+        auto& subscribers = model.pimpl->subscribers;
+        for (NodeUuid const& nodeUuid : iter->second.targets)
+        {
+            auto list = subscribers.find(nodeUuid);
+            if (list == subscribers.end()) continue;
+
+            utils::erase(*list, id);
+            if (list->empty()) subscribers.erase(list);
+        }
+
+        CompletionCallback callback = std::move(iter->second.callback);
+        subscriptions.erase(iter);
+        return callback;
+    }
+
+    /**
+     * @brief Removes the subscription and invokes its callback.
+     * @param model Exec model
+     * @param id Subscription id
+     * @param success Whether all targets have evaluated successfully
+     */
+    static inline void
+    finishSubscription(GraphExecutionModel& model, size_t id, bool success)
+    {
+        // callback may access the model
+        if (CompletionCallback callback = unsubscribe(model, id))
+        {
+            callback(success);
+        }
+    }
+
+    /**
+     * @brief Notifies the subscriptions waiting for the given node. Should be
+     * called once the node has (failed) evaluation.
+     * @param model Exec model
+     * @param nodeUuid Node that has (failed) evaluation
+     */
+    static inline void
+    notifySubscribers(GraphExecutionModel& model, NodeUuid const& nodeUuid)
+    {
+        auto& subscribers = model.pimpl->subscribers;
+        auto iter = subscribers.find(nodeUuid);
+        if (iter == subscribers.end()) return;
+
+        NodeEvalState state = model.nodeEvalState(nodeUuid);
+        if (state != NodeEvalState::Valid &&
+            state != NodeEvalState::Invalid) return;
+
+        std::vector<size_t> ids = std::move(*iter);
+        subscribers.erase(iter);
+
+        for (size_t id : ids)
+        {
+            if (state == NodeEvalState::Invalid)
+            {
+                finishSubscription(model, id, false);
+                continue;
+            }
+
+            auto subscription = model.pimpl->subscriptions.find(id);
+            if (subscription == model.pimpl->subscriptions.end()) continue;
+
+            size_t& remaining = subscription->second.remaining;
+            assert(remaining > 0);
+            if (--remaining > 0) continue;
+
+            // targets may have been invalidated in the meantime
+            bool failed = false;
+            for (NodeUuid const& target : subscription->second.targets)
+            {
+                NodeEvalState targetState = model.nodeEvalState(target);
+                if (targetState == NodeEvalState::Valid) continue;
+                if (targetState == NodeEvalState::Invalid)
+                {
+                    failed = true;
+                    break;
+                }
+                subscribers[target].push_back(id);
+                remaining++;
+            }
+
+            if (failed || remaining == 0) finishSubscription(model, id, !failed);
+        }
+    }
+
+    /**
+     * @brief Notifies all subscriptions affected by the (failed) evaluation of
+     * the given node, i.e. the subscriptions waiting for the node, its parent
+     * graphs, and for nodes that failed in the meantime.
+     * @param model Exec model
+     * @param nodeUuid Node that has (failed) evaluation
+     */
+    static inline void
+    onNodeEvaluationSignaled(GraphExecutionModel& model, NodeUuid const& nodeUuid)
+    {
+        if (model.pimpl->subscribers.empty())
+        {
+            model.pimpl->failedNodes.clear();
+            return;
+        }
+
+        notifySubscribers(model, nodeUuid);
+
+        // parent graphs are evaluating as long as child nodes are evaluating
+        if (auto item = findData(model, nodeUuid))
+        {
+            for (Graph* graph = Graph::accessGraph(*item.node);
+                 graph && graph != graph->rootGraph();
+                 graph = graph->parentGraph())
+            {
+                notifySubscribers(model, graph->uuid());
+            }
+        }
+
+        std::vector<NodeUuid> failedNodes;
+        std::swap(failedNodes, model.pimpl->failedNodes);
+        for (NodeUuid const& failed : failedNodes)
+        {
+            notifySubscribers(model, failed);
+        }
+    }
+
     /**
      * @brief Attempts to evalaute all queued nodes.
      * @param model Exec model
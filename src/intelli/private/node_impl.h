@@ -26,6 +26,8 @@ struct Node::Impl
 {
     using PortInfo      = Node::PortInfo;
     using WidgetFactory = Node::WidgetFactory;
+    using ResourceFunction = Node::ResourceFunction;
+    using InputDemandFunction = Node::InputDemandFunction;
 
     Impl(QString const& name) : modelName(name) { }
 
@@ -77,6 +79,14 @@ struct Node::Impl
     NodeFlags flags{NodeFlag::DefaultNodeFlags};
     /// node eval mode
     NodeEvalMode evalMode{NodeEvalMode::Default};
+    /// function for determining the resources of the node
+    ResourceFunction resources{};
+    /// version of the implementation, invalidates cached results
+    int cacheVersion{0};
+    /// declared dependencies between input and output ports (in, out)
+    std::vector<std::pair<PortId, PortId>> portDependencies{};
+    /// function for determining the demanded lazy input ports
+    InputDemandFunction inputDemand{};
     /// iterator for the next port id
     PortId nextPortId{0};
 
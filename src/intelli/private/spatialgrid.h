@@ -0,0 +1,209 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#ifndef GT_INTELLI_SPATIALGRID_H
+#define GT_INTELLI_SPATIALGRID_H
+
+#include <QHash>
+#include <QRectF>
+#include <QSet>
+#include <QVector>
+
+#include <cmath>
+
+namespace intelli
+{
+
+/**
+ * @brief Spatial index, that maps rectangular regions to keys using a uniform
+ * grid. Allows to find the keys within a region without visiting all keys.
+ * Keys that span many cells are kept in a separate list, which is always
+ * visited.
+ */
+template <typename Key>
+class SpatialGrid
+{
+public:
+
+    /// max. number of cells an entry may span before it is considered large
+    static constexpr int MaxCells = 64;
+
+    /**
+     * @brief Constructor
+     * @param cellSize Size of a cell
+     */
+    explicit SpatialGrid(double cellSize = 1000) :
+        m_cellSize(cellSize)
+    { }
+
+    /**
+     * @brief Inserts or moves the key to the given region
+     * @param key Key
+     * @param rect Region of the key
+     */
+    void insert(Key const& key, QRectF const& rect)
+    {
+        remove(key);
+
+        Entry entry{rect, cellRange(rect)};
+        if ((qint64)entry.cells.width() * entry.cells.height() > MaxCells)
+        {
+            m_large.insert(key);
+        }
+        else
+        {
+            forEachCell(entry.cells, [this, &key](quint64 cell){
+                m_cells[cell].push_back(key);
+            });
+        }
+        m_entries.insert(key, entry);
+    }
+
+    /**
+     * @brief Removes the key
+     * @param key Key
+     */
+    void remove(Key const& key)
+    {
+        auto iter = m_entries.find(key);
+        if (iter == m_entries.end()) return;
+
+        if (!m_large.remove(key))
+        {
+            forEachCell(iter->cells, [this, &key](quint64 cell){
+                auto cellIter = m_cells.find(cell);
+                if (cellIter == m_cells.end()) return;
+
+                cellIter->removeOne(key);
+                if (cellIter->isEmpty()) m_cells.erase(cellIter);
+            });
+        }
+        m_entries.erase(iter);
+    }
+
+    /// Removes all keys
+    void clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_large.clear();
+    }
+
+    /**
+     * @brief Returns the region of the key
+     * @param key Key
+     * @return Region (null if the key is not indexed)
+     */
+    QRectF rect(Key const& key) const { return m_entries.value(key).rect; }
+
+    /**
+     * @brief Returns whether the key is indexed
+     * @param key Key
+     * @return Whether the key is indexed
+     */
+    bool contains(Key const& key) const { return m_entries.contains(key); }
+
+    /**
+     * @brief Returns the number of keys
+     * @return Number of keys
+     */
+    int size() const { return m_entries.size(); }
+
+    /**
+     * @brief Returns the keys whose region intersects `rect`. Only the cells
+     * covered by `rect` and the large entries are visited.
+     * @param rect Region to search
+     * @return Keys
+     */
+    QSet<Key> find(QRectF const& rect) const
+    {
+        QSet<Key> keys;
+
+        auto const append = [this, &rect, &keys](Key const& key){
+            if (m_entries.value(key).rect.intersects(rect)) keys.insert(key);
+        };
+
+        QRect const range = cellRange(rect);
+
+        // visit the occupied cells if the region covers more cells
+        if ((qint64)range.width() * range.height() > m_cells.size())
+        {
+            for (auto iter = m_cells.begin(); iter != m_cells.end(); ++iter)
+            {
+                if (!range.contains(cellPos(iter.key()))) continue;
+                for (Key const& key : *iter) append(key);
+            }
+        }
+        else
+        {
+            forEachCell(range, [this, &append](quint64 cell){
+                auto iter = m_cells.find(cell);
+                if (iter == m_cells.end()) return;
+                for (Key const& key : *iter) append(key);
+            });
+        }
+
+        for (Key const& key : m_large) append(key);
+
+        return keys;
+    }
+
+private:
+
+    struct Entry
+    {
+        /// region of the entry
+        QRectF rect;
+        /// cells covered by the region
+        QRect cells;
+    };
+
+    /// size of a cell
+    double m_cellSize;
+    /// indexed entries
+    QHash<Key, Entry> m_entries;
+    /// keys per occupied cell
+    QHash<quint64, QVector<Key>> m_cells;
+    /// keys of entries that span too many cells
+    QSet<Key> m_large;
+
+    QRect cellRange(QRectF const& rect) const
+    {
+        return QRect{QPoint{(int)std::floor(rect.left()   / m_cellSize),
+                            (int)std::floor(rect.top()    / m_cellSize)},
+                     QPoint{(int)std::floor(rect.right()  / m_cellSize),
+                            (int)std::floor(rect.bottom() / m_cellSize)}};
+    }
+
+    static quint64 cellKey(int x, int y)
+    {
+        return ((quint64)(quint32)x << 32) | (quint32)y;
+    }
+
+    static QPoint cellPos(quint64 key)
+    {
+        return QPoint{(int)(quint32)(key >> 32), (int)(quint32)key};
+    }
+
+    template <typename Func>
+    static void forEachCell(QRect const& range, Func const& func)
+    {
+        for (int x = range.left(); x <= range.right(); ++x)
+        {
+            for (int y = range.top(); y <= range.bottom(); ++y)
+            {
+                func(cellKey(x, y));
+            }
+        }
+    }
+};
+
+} // namespace intelli
+
+#endif // GT_INTELLI_SPATIALGRID_H
@@ -0,0 +1,32 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include <intelli/node.h>
+
+#include <gt_coreapplication.h>
+
+#include <QCoreApplication>
+
+/// Worker process that evaluates nodes in isolation. The modules are loaded
+/// such that all node and data classes are known.
+int
+main(int argc, char* argv[])
+{
+    QCoreApplication::setOrganizationDomain(QStringLiteral("www.dlr.de"));
+    QCoreApplication::setOrganizationName(QStringLiteral("DLR"));
+    QCoreApplication::setApplicationName(QStringLiteral("GTlab"));
+
+    QCoreApplication a(argc, argv);
+
+    GtCoreApplication app(qApp);
+    app.init();
+    app.loadModules();
+
+    return intelli::exec::runWorker();
+}
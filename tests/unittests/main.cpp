@@ -15,6 +15,7 @@
 
 #include <intelli/connection.h>
 #include <intelli/core.h>
+#include <intelli/node.h>
 #include <intelli/nodefactory.h>
 
 #include <gt_objectfactory.h>
@@ -40,16 +41,25 @@ main(int argc, char** argv)
         TestNode::registerOnce();
         TestSleepyNode::registerOnce();
         TestNumberInputNode::registerOnce();
+        TestIsolatedNode::registerOnce();
+        TestCacheableNode::registerOnce();
+        TestAsyncNode::registerOnce();
         TestNodeData::registerOnce();
         gtObjectFactory->registerClass(intelli::Connection::staticMetaObject);
     }();
 
     QCoreApplication a(argc, argv);
 
-    ::testing::InitGoogleTest(&argc, argv);
-
     intelli::initModule();
 
+    // the test executable is used as a worker process as well
+    if (a.arguments().contains(QStringLiteral("--worker")))
+    {
+        return intelli::exec::runWorker();
+    }
+
+    ::testing::InitGoogleTest(&argc, argv);
+
     bool success = RUN_ALL_TESTS();
 
     return success;
@@ -10,6 +10,10 @@
 #include "test_node.h"
 
 #include <intelli/nodefactory.h>
+#include <intelli/data/double.h>
+
+#include <cstdlib>
+#include <thread>
 
 void
 TestNode::registerOnce()
@@ -60,3 +64,97 @@ TestNumberInputNode::TestNumberInputNode() :
 {
     setNodeEvalMode(NodeEvalMode::Detached); // for unittesting
 }
+
+void
+TestIsolatedNode::registerOnce()
+{
+    static auto _ = []{
+        return GT_INTELLI_REGISTER_NODE(TestIsolatedNode, "Test");
+    }();
+    Q_UNUSED(_);
+}
+
+TestIsolatedNode::TestIsolatedNode() :
+    intelli::Node("Isolated Node"),
+    crash("crash", tr("Crash"), tr("Crash the process"), false)
+{
+    registerProperty(crash);
+
+    setNodeEvalMode(NodeEvalMode::Isolated);
+
+    m_in  = addInPort(intelli::typeId<intelli::DoubleData>());
+    m_out = addOutPort(intelli::typeId<intelli::DoubleData>());
+}
+
+void
+TestIsolatedNode::eval()
+{
+    if (crash.get()) std::abort();
+
+    auto data = nodeData<intelli::DoubleData>(m_in);
+    if (!data) return evalFailed();
+
+    setNodeData(m_out, std::make_shared<intelli::DoubleData>(data->value() * 2));
+}
+
+void
+TestCacheableNode::registerOnce()
+{
+    static auto _ = []{
+        return GT_INTELLI_REGISTER_NODE(TestCacheableNode, "Test");
+    }();
+    Q_UNUSED(_);
+}
+
+TestCacheableNode::TestCacheableNode() :
+    intelli::Node("Cacheable Node")
+{
+    setNodeFlag(intelli::NodeFlag::Cacheable);
+    setNodeEvalMode(NodeEvalMode::Blocking);
+
+    m_in  = addInPort(intelli::typeId<intelli::DoubleData>());
+    m_out = addOutPort(intelli::typeId<intelli::DoubleData>());
+}
+
+void
+TestCacheableNode::eval()
+{
+    evalCount++;
+
+    auto data = nodeData<intelli::DoubleData>(m_in);
+    if (!data) return evalFailed();
+
+    setNodeData(m_out, std::make_shared<intelli::DoubleData>(data->value() * 2));
+}
+
+void
+TestAsyncNode::registerOnce()
+{
+    static auto _ = []{
+        return GT_INTELLI_REGISTER_NODE(TestAsyncNode, "Test");
+    }();
+    Q_UNUSED(_);
+}
+
+TestAsyncNode::TestAsyncNode() :
+    intelli::Node("Async Node")
+{
+    setNodeEvalMode(NodeEvalMode::Async);
+
+    m_in  = addInPort(intelli::typeId<intelli::DoubleData>());
+    m_out = addOutPort(intelli::typeId<intelli::DoubleData>());
+}
+
+void
+TestAsyncNode::evalAsync(intelli::EvalPromise promise)
+{
+    auto data = nodeData<intelli::DoubleData>(m_in);
+    if (!data || failEvaluation) return promise.fail();
+
+    // simulates waiting for I/O without occupying a thread of the pool
+    std::thread([promise, out = m_out, value = data->value()]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        promise.setNodeData(out, std::make_shared<intelli::DoubleData>(value * 2));
+        promise.finish();
+    }).detach();
+}
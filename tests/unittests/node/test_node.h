@@ -14,6 +14,8 @@
 #include <intelli/node/sleepy.h>
 #include <intelli/node/input/doubleinput.h>
 
+#include <gt_boolproperty.h>
+
 /**
  * @brief The TestNode class. Can be used to test nodes that fail to evaluate
  */
@@ -36,6 +38,7 @@ public:
     using Node::addInPort;
     using Node::addOutPort;
     using Node::removePort;
+    using Node::addPortDependency;
 
 protected:
 
@@ -56,6 +59,7 @@ public:
 
     using Node::setFlag;
     using Node::setNodeEvalMode;
+    using Node::setResources;
 };
 
 /**
@@ -74,4 +78,82 @@ public:
     Q_INVOKABLE TestNumberInputNode();
 };
 
+/**
+ * @brief The TestIsolatedNode class. Is evaluated in a worker process and
+ * doubles its input. Can be used to crash the worker process.
+ */
+class TestIsolatedNode : public intelli::Node
+{
+    Q_OBJECT
+
+public:
+
+    static void registerOnce();
+
+    Q_INVOKABLE TestIsolatedNode();
+
+    /// whether the evaluation should crash the process
+    GtBoolProperty crash;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    intelli::PortId m_in, m_out;
+};
+
+/**
+ * @brief The TestCacheableNode class. Doubles its input and may be cached
+ * (see `NodeFlag::Cacheable`). Counts its evaluations.
+ */
+class TestCacheableNode : public intelli::Node
+{
+    Q_OBJECT
+
+public:
+
+    static void registerOnce();
+
+    Q_INVOKABLE TestCacheableNode();
+
+    /// number of evaluations
+    int evalCount = 0;
+
+protected:
+
+    void eval() override;
+
+private:
+
+    intelli::PortId m_in, m_out;
+};
+
+/**
+ * @brief The TestAsyncNode class. Is evaluated asynchronously and doubles its
+ * input. The promise is completed in a separate thread after a delay.
+ */
+class TestAsyncNode : public intelli::Node
+{
+    Q_OBJECT
+
+public:
+
+    static void registerOnce();
+
+    Q_INVOKABLE TestAsyncNode();
+
+    /// whether the evaluation should fail
+    bool failEvaluation = false;
+
+protected:
+
+    void evalAsync(intelli::EvalPromise promise) override;
+
+private:
+
+    intelli::PortId m_in, m_out;
+};
+
 #endif // TESTNODE_H
@@ -0,0 +1,206 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+
+#include "intelli/graphexecmodel.h"
+#include "intelli/data/array.h"
+#include "intelli/data/double.h"
+#include "intelli/data/list.h"
+
+#include <QDataStream>
+
+#include <numeric>
+
+using namespace intelli;
+
+constexpr auto maxTimeout = std::chrono::seconds(1);
+
+/// Adds a single node of type `className` to the graph
+Node* addArrayNode(Graph& graph, QString const& className, QString const& operation)
+{
+    GraphBuilder builder(graph);
+
+    try
+    {
+        Node& node = builder.addNode(className, A_uuid).setCaption("A");
+        setNodeProperty(node, QStringLiteral("operation"), operation);
+        return &node;
+    }
+    catch (std::logic_error const& e)
+    {
+        gtError() << e.what();
+        return nullptr;
+    }
+}
+
+/// Arrays can be serialized and compared
+TEST(ArrayData, serialize_and_deserialize)
+{
+    DoubleArrayData data{{1.0, 2.5, -3.0}};
+    EXPECT_EQ(data.size(), 3);
+    EXPECT_EQ(data.count(), 3);
+    EXPECT_EQ(data.view()[1], 2.5);
+    EXPECT_EQ(data.at(42), 0.0);
+    EXPECT_EQ(data.byteSize(), 3 * sizeof(double));
+
+    QByteArray bytes;
+    {
+        QDataStream stream(&bytes, QIODevice::WriteOnly);
+        ASSERT_TRUE(data.serialize(stream));
+    }
+
+    DoubleArrayData other;
+    EXPECT_FALSE(data.isEqualTo(other));
+    {
+        QDataStream stream(&bytes, QIODevice::ReadOnly);
+        ASSERT_TRUE(other.deserialize(stream));
+    }
+    EXPECT_TRUE(data.isEqualTo(other));
+    EXPECT_EQ(other.value(), data.value());
+}
+
+/// Scalars, lists and other arrays can be converted to double arrays
+TEST(ArrayData, conversions)
+{
+    auto scalar = convert<DoubleArrayData>(std::make_shared<DoubleData>(42));
+    ASSERT_TRUE(scalar);
+    EXPECT_EQ(scalar->value(), std::vector<double>{42});
+
+    auto ints = convert<DoubleArrayData>(std::make_shared<IntArrayData>(std::vector<int>{1, 2}));
+    ASSERT_TRUE(ints);
+    EXPECT_EQ(ints->value(), (std::vector<double>{1, 2}));
+
+    auto list = std::make_shared<ListData>(std::vector<NodeDataPtr>{
+        std::make_shared<DoubleData>(1), std::make_shared<DoubleData>(2)
+    });
+    auto fromList = convert<DoubleArrayData>(list);
+    ASSERT_TRUE(fromList);
+    EXPECT_EQ(fromList->value(), (std::vector<double>{1, 2}));
+
+    auto toList = convert<ListData>(fromList);
+    ASSERT_TRUE(toList);
+    EXPECT_TRUE(toList->isEqualTo(*list));
+}
+
+/// Arrays are combined element-wise, arrays of size one are broadcasted
+TEST(ArrayNodes, math_with_broadcasting)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    Node* node = addArrayNode(graph, QStringLiteral("intelli::ArrayMathNode"),
+                              QStringLiteral("Multiply"));
+    ASSERT_TRUE(node);
+
+    // large enough to be processed in parallel chunks
+    std::vector<double> values(100000);
+    std::iota(values.begin(), values.end(), 0.0);
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<DoubleArrayData>(values)));
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(1),
+                                  convert<DoubleArrayData>(std::make_shared<DoubleData>(2))));
+
+    ASSERT_TRUE(model.evaluateNode(A_uuid).wait(maxTimeout));
+
+    auto result = model.nodeData(A_uuid, PortType::Out, PortIndex(0)).as<DoubleArrayData>();
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(result->at(i), values[i] * 2);
+    }
+
+    gtDebug() << "Evaluating arrays of different sizes...";
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(1),
+                                  std::make_shared<DoubleArrayData>(std::vector<double>{1, 2})));
+
+    EXPECT_FALSE(model.evaluateNode(A_uuid).wait(maxTimeout));
+    EXPECT_EQ(model.nodeEvalState(A_uuid), NodeEvalState::Invalid);
+}
+
+/// Comparisons and logic operations yield masks
+TEST(ArrayNodes, compare_and_logic)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    Node* node = addArrayNode(graph, QStringLiteral("intelli::ArrayCompareNode"),
+                              QStringLiteral("Greater"));
+    ASSERT_TRUE(node);
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<DoubleArrayData>(std::vector<double>{1, 5, 3, 7})));
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(1),
+                                  std::make_shared<DoubleArrayData>(std::vector<double>{4})));
+
+    ASSERT_TRUE(model.evaluateNode(A_uuid).wait(maxTimeout));
+
+    auto mask = model.nodeData(A_uuid, PortType::Out, PortIndex(0)).as<IntArrayData>();
+    ASSERT_TRUE(mask);
+    EXPECT_EQ(mask->value(), (std::vector<int>{0, 1, 0, 1}));
+
+    Graph logicGraph;
+    GraphExecutionModel logicModel(logicGraph);
+
+    node = addArrayNode(logicGraph, QStringLiteral("intelli::ArrayLogicNode"),
+                        QStringLiteral("XOR"));
+    ASSERT_TRUE(node);
+
+    ASSERT_TRUE(logicModel.setNodeData(A_uuid, PortType::In, PortIndex(0), mask));
+    ASSERT_TRUE(logicModel.setNodeData(A_uuid, PortType::In, PortIndex(1),
+                                       std::make_shared<IntArrayData>(std::vector<int>{1, 1, 0, 0})));
+
+    ASSERT_TRUE(logicModel.evaluateNode(A_uuid).wait(maxTimeout));
+
+    auto result = logicModel.nodeData(A_uuid, PortType::Out, PortIndex(0)).as<IntArrayData>();
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->value(), (std::vector<int>{1, 0, 0, 1}));
+}
+
+/// Arrays are reduced in parallel chunks
+TEST(ArrayNodes, reduction)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    Node* node = addArrayNode(graph, QStringLiteral("intelli::ArrayReduceNode"),
+                              QStringLiteral("Sum"));
+    ASSERT_TRUE(node);
+
+    std::vector<double> values(100000);
+    std::iota(values.begin(), values.end(), 1.0);
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<DoubleArrayData>(values)));
+
+    ASSERT_TRUE(model.evaluateNode(A_uuid).wait(maxTimeout));
+
+    auto result = model.nodeData(A_uuid, PortType::Out, PortIndex(0)).as<DoubleData>();
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), 100000.0 * 100001.0 / 2);
+
+    setNodeProperty(*node, QStringLiteral("operation"), QStringLiteral("Max"));
+    EXPECT_TRUE(model.invalidateNode(A_uuid));
+    ASSERT_TRUE(model.evaluateNode(A_uuid).wait(maxTimeout));
+
+    result = model.nodeData(A_uuid, PortType::Out, PortIndex(0)).as<DoubleData>();
+    ASSERT_TRUE(result);
+    EXPECT_DOUBLE_EQ(result->value(), 100000.0);
+
+    gtDebug() << "Reducing an empty array...";
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<DoubleArrayData>()));
+
+    EXPECT_FALSE(model.evaluateNode(A_uuid).wait(maxTimeout));
+    EXPECT_EQ(model.nodeEvalState(A_uuid), NodeEvalState::Invalid);
+}
@@ -0,0 +1,174 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+#include "node/test_node.h"
+
+#include "intelli/executionplan.h"
+#include "intelli/graphexecmodel.h"
+#include "intelli/data/double.h"
+
+using namespace intelli;
+
+constexpr auto maxTimeout = std::chrono::seconds(1);
+
+/// Subgraphs and providers are resolved, the results match the exec model
+TEST(ExecutionPlan, evaluate_graph_with_group)
+{
+    Graph graph;
+
+    ASSERT_TRUE(test::buildGraphWithGroup(graph));
+
+    auto plan = ExecutionPlan::compile(graph);
+    ASSERT_TRUE(plan.isValid());
+
+    // forwarding nodes are not part of the plan
+    EXPECT_FALSE(plan.contains(group_uuid));
+    EXPECT_FALSE(plan.contains(group_input_uuid));
+    EXPECT_FALSE(plan.contains(group_output_uuid));
+    EXPECT_TRUE(plan.contains(group_C_uuid));
+    EXPECT_EQ(plan.size(), 8);
+
+    PlanExecutor executor{plan};
+    ASSERT_TRUE(executor.isValid());
+    EXPECT_TRUE(executor.run());
+
+    GraphExecutionModel model(graph);
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    Node* D = graph.findNodeByUuid(D_uuid);
+    ASSERT_TRUE(D);
+    PortId outPort = D->portId(PortType::Out, PortIndex(0));
+
+    auto expected = convert<DoubleData>(model.nodeData(D_uuid, outPort).ptr);
+    auto actual = convert<DoubleData>(executor.nodeData(D_uuid, outPort));
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(actual->value(), expected->value());
+
+    // the graph itself is not altered
+    EXPECT_NE(executor.findNode(D_uuid), D);
+}
+
+/// Lazy inputs are only evaluated if demanded, the plan can be run repeatedly
+TEST(ExecutionPlan, evaluate_lazy_inputs_on_demand)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("intelli::BoolInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("TestNumberInputNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("TestNumberInputNode"), C_uuid)
+                  .setCaption("C");
+    Node& D = builder.addNode(QStringLiteral("intelli::SwitchNode"), D_uuid)
+                  .setCaption("D");
+
+    builder.connect(A, PortIndex(0), D, PortIndex(0));
+    builder.connect(B, PortIndex(0), D, PortIndex(1));
+    builder.connect(C, PortIndex(0), D, PortIndex(2));
+
+    setNodeProperty(A, QStringLiteral("value"), true);
+    setNodeProperty(B, QStringLiteral("value"), 1);
+    setNodeProperty(C, QStringLiteral("value"), 2);
+
+    PlanExecutor executor{ExecutionPlan::compile(graph)};
+    ASSERT_TRUE(executor.isValid());
+
+    PortId outPort = D.portId(PortType::Out, PortIndex(0));
+
+    EXPECT_TRUE(executor.run());
+
+    EXPECT_TRUE(executor.isNodeEvaluated(B_uuid));
+    EXPECT_FALSE(executor.isNodeEvaluated(C_uuid));
+
+    auto data = convert<DoubleData>(executor.nodeData(D_uuid, outPort));
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 1.0);
+
+    gtDebug() << "Switching branch...";
+
+    Node* a = executor.findNode(A_uuid);
+    ASSERT_TRUE(a);
+    setNodeProperty(*a, QStringLiteral("value"), false);
+
+    EXPECT_TRUE(executor.run());
+
+    EXPECT_FALSE(executor.isNodeEvaluated(B_uuid));
+    EXPECT_TRUE(executor.isNodeEvaluated(C_uuid));
+
+    data = convert<DoubleData>(executor.nodeData(D_uuid, outPort));
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 2.0);
+}
+
+/// Only the sinks and their dependencies are compiled
+TEST(ExecutionPlan, compile_sinks)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    TestNode& B = builder.addNode<TestNode>(B_uuid);
+    B.setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("TestNumberInputNode"), C_uuid)
+                  .setCaption("C");
+    Node& D = builder.addNode(QStringLiteral("intelli::NumberDisplayNode"), D_uuid)
+                  .setCaption("D");
+
+    B.addInPort(typeId<DoubleData>());
+    B.setNodeFlag(NodeFlag::Sink);
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    /// dangling branch
+    builder.connect(C, PortIndex(0), D, PortIndex(0));
+
+    auto plan = ExecutionPlan::compileSinks(graph);
+    ASSERT_TRUE(plan.isValid());
+
+    EXPECT_EQ(plan.size(), 2);
+    EXPECT_TRUE(plan.contains(A_uuid));
+    EXPECT_TRUE(plan.contains(B_uuid));
+    EXPECT_FALSE(plan.contains(C_uuid));
+    EXPECT_FALSE(plan.contains(D_uuid));
+
+    PlanExecutor executor{plan};
+    EXPECT_TRUE(executor.run());
+    EXPECT_TRUE(executor.isNodeEvaluated(B_uuid));
+}
+
+/// Async nodes are evaluated synchronously by the executor
+TEST(ExecutionPlan, evaluate_async_node)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    TestAsyncNode& B = builder.addNode<TestAsyncNode>(B_uuid);
+    B.setCaption("B");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+
+    setNodeProperty(A, QStringLiteral("value"), 21);
+
+    PlanExecutor executor{ExecutionPlan::compile(graph)};
+    ASSERT_TRUE(executor.isValid());
+    EXPECT_TRUE(executor.run());
+
+    PortId outPort = B.portId(PortType::Out, PortIndex(0));
+    auto data = convert<DoubleData>(executor.nodeData(B_uuid, outPort));
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 42.0);
+}
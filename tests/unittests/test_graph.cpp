@@ -939,3 +939,45 @@ TEST(Graph, move_graph_to_other_graph)
     EXPECT_NE(graph1.globalConnectionModel().size(), globalConnections);
     EXPECT_EQ(graph2.globalConnectionModel().size(), globalConnections);
 }
+
+TEST(Graph, move_graph_updates_global_connection_model_incrementally)
+{
+    Graph graph1;
+    Graph graph2;
+
+    ASSERT_TRUE(test::buildGraphWithGroup(graph1));
+
+    auto* target = qobject_cast<Graph*>(graph1.appendNode(std::make_unique<Graph>()));
+    ASSERT_TRUE(target);
+
+    // move group within the same graph hierarchy
+    EXPECT_TRUE(graph1.moveNode(group_id, *target));
+
+    auto* group = target->findNodeByUuid(group_uuid);
+    ASSERT_TRUE(group);
+    EXPECT_EQ(group->parent(), target);
+
+    auto globalModel = graph1.globalConnectionModel();
+    graph1.resetGlobalConnectionModel();
+    EXPECT_TRUE(graph1.globalConnectionModel() == globalModel);
+
+    // output of group is still forwarded to the graph node
+    EXPECT_FALSE(graph1.globalConnectionModel()
+                     .iterateConnections(group_uuid, PortType::In).empty());
+
+    // move group to a different graph hierarchy
+    EXPECT_TRUE(target->moveNode(group->id(), graph2));
+
+    EXPECT_FALSE(graph1.globalConnectionModel().contains(group_uuid));
+    EXPECT_FALSE(graph1.globalConnectionModel().contains(group_A_uuid));
+    EXPECT_TRUE(graph2.globalConnectionModel().contains(group_uuid));
+    EXPECT_TRUE(graph2.globalConnectionModel().contains(group_A_uuid));
+
+    auto globalModel1 = graph1.globalConnectionModel();
+    graph1.resetGlobalConnectionModel();
+    EXPECT_TRUE(graph1.globalConnectionModel() == globalModel1);
+
+    auto globalModel2 = graph2.globalConnectionModel();
+    graph2.resetGlobalConnectionModel();
+    EXPECT_TRUE(graph2.globalConnectionModel() == globalModel2);
+}
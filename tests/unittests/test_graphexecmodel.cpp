@@ -13,6 +13,9 @@
 #include "intelli/memory.h"
 #include "intelli/graphexecmodel.h"
 #include "intelli/data/double.h"
+#include "intelli/data/list.h"
+#include "intelli/data/string.h"
+#include "intelli/node/map.h"
 #include "intelli/node/groupinputprovider.h"
 #include "intelli/node/groupoutputprovider.h"
 
@@ -23,6 +26,12 @@
 
 #include <gt_algorithms.h>
 
+#include <QFutureWatcher>
+#include <QTemporaryDir>
+#include <QThreadPool>
+#include <QTimer>
+#include <QtConcurrent>
+
 using namespace intelli;
 
 constexpr auto maxTimeout = std::chrono::seconds(1);
@@ -890,6 +899,733 @@ TEST(GraphExecutionModel, propagate_invalidation)
     }
 }
 
+/// Nodes whose inputs did not change are not reevaluated, even though they
+/// were invalidated by one of their predecessors (early cutoff)
+TEST(GraphExecutionModel, skip_evaluation_of_nodes_with_unchanged_inputs)
+{
+    Graph graph;
+
+    GraphExecutionModel model(graph);
+
+    ASSERT_TRUE(test::buildLinearGraph(graph));
+
+    QVector<NodeUuid> evaluatedNodes;
+    for (Node* node : graph.nodes())
+    {
+        QObject::connect(node, &Node::computingStarted, &model,
+                         [&evaluatedNodes, uuid = node->uuid()](){
+            evaluatedNodes.push_back(uuid);
+        }, Qt::DirectConnection);
+    }
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    EXPECT_EQ(evaluatedNodes.size(), 4);
+    evaluatedNodes.clear();
+
+    gtDebug() << "Invalidating...";
+
+    /// invalidate node A -> successors are outdated
+    ASSERT_TRUE(model.invalidateNode(A_uuid));
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid},
+        NodeEvalState::Outdated));
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    /// output of node A did not change -> only node A is reevaluated
+    EXPECT_EQ(evaluatedNodes, QVector<NodeUuid>{A_uuid});
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid},
+        NodeEvalState::Valid));
+
+    constexpr double EXPECTED_VALUE_C = 42.0 * 2;
+
+    EXPECT_TRUE(test::comparePortData<double>(graph, model, {
+        {C_uuid, PortType::Out, PortIndex(0), PortDataState::Valid, EXPECTED_VALUE_C},
+        {D_uuid, PortType::In , PortIndex(0), PortDataState::Valid, EXPECTED_VALUE_C}
+    }));
+}
+
+/// Only the outputs that depend on the changed input are invalidated and thus
+/// only the successors connected to these outputs
+TEST(GraphExecutionModel, propagate_invalidation_using_port_dependencies)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& S1 = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                   .setCaption("S1");
+    Node& S2 = builder.addNode(QStringLiteral("TestNumberInputNode"), B_uuid)
+                   .setCaption("S2");
+    TestNode& N = builder.addNode<TestNode>(C_uuid);
+    N.setCaption("N");
+    TestNode& T1 = builder.addNode<TestNode>(D_uuid);
+    T1.setCaption("T1");
+    TestNode& T2 = builder.addNode<TestNode>(E_uuid);
+    T2.setCaption("T2");
+
+    PortId in1  = N.addInPort(typeId<DoubleData>());
+    PortId in2  = N.addInPort(typeId<DoubleData>());
+    PortId out1 = N.addOutPort(typeId<DoubleData>());
+    PortId out2 = N.addOutPort(typeId<DoubleData>());
+    T1.addInPort(typeId<DoubleData>());
+    T2.addInPort(typeId<DoubleData>());
+
+    N.addPortDependency(in1, out1);
+    N.addPortDependency(in2, out2);
+
+    EXPECT_TRUE(N.hasPortDependencies());
+    EXPECT_EQ(N.dependentOutPorts(in2), std::vector<PortId>{out2});
+
+    builder.connect(S1, PortIndex(0), N, PortIndex(0));
+    builder.connect(S2, PortIndex(0), N, PortIndex(1));
+    builder.connect(N, PortIndex(0), T1, PortIndex(0));
+    builder.connect(N, PortIndex(1), T2, PortIndex(0));
+
+    GraphExecutionModel model(graph);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid, E_uuid},
+        NodeEvalState::Valid));
+
+    gtDebug() << "Invalidating...";
+
+    /// invalidate S2 -> only second output of N and T2 are outdated
+    ASSERT_TRUE(model.invalidateNode(S2.uuid()));
+
+    EXPECT_TRUE(test::compareNodeEvalState(graph, model, {
+        {A_uuid, NodeEvalState::Valid},
+        {B_uuid, NodeEvalState::Outdated},
+        {C_uuid, NodeEvalState::Outdated},
+        {D_uuid, NodeEvalState::Valid},
+        {E_uuid, NodeEvalState::Outdated}
+    }));
+
+    EXPECT_EQ(model.nodeData(N.uuid(), out1).state, PortDataState::Valid);
+    EXPECT_EQ(model.nodeData(N.uuid(), out2).state, PortDataState::Outdated);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid, E_uuid},
+        NodeEvalState::Valid));
+}
+
+/// Evaluating the sinks of a graph only evaluates the nodes the sinks depend on
+TEST(GraphExecutionModel, evaluate_sinks)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    TestNode& B = builder.addNode<TestNode>(B_uuid);
+    B.setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("TestNumberInputNode"), C_uuid)
+                  .setCaption("C");
+    Node& D = builder.addNode(QStringLiteral("intelli::NumberDisplayNode"), D_uuid)
+                  .setCaption("D");
+
+    B.addInPort(typeId<DoubleData>());
+    B.setNodeFlag(NodeFlag::Sink);
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    /// dangling branch
+    builder.connect(C, PortIndex(0), D, PortIndex(0));
+
+    GraphExecutionModel model(graph);
+
+    EXPECT_TRUE(model.evaluateSinks().wait(maxTimeout));
+
+    EXPECT_TRUE(test::compareNodeEvalState(graph, model, {
+        {A_uuid, NodeEvalState::Valid},
+        {B_uuid, NodeEvalState::Valid},
+        {C_uuid, NodeEvalState::Outdated},
+        {D_uuid, NodeEvalState::Outdated}
+    }));
+
+    /// evaluate the dangling branch explicitly
+    EXPECT_TRUE(model.evaluateNodes({D_uuid}).wait(maxTimeout));
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid},
+        NodeEvalState::Valid));
+}
+
+/// Calculator nodes have side effects and are evaluated as sinks, even if the
+/// graph contains other sinks
+TEST(GraphExecutionModel, evaluate_sinks_with_calculator_leaf)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    TestNode& B = builder.addNode<TestNode>(B_uuid);
+    B.setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("intelli::GenericCalculatorExecNode"), C_uuid)
+                  .setCaption("C");
+    Node& D = builder.addNode(QStringLiteral("intelli::NumberDisplayNode"), D_uuid)
+                  .setCaption("D");
+
+    B.addInPort(typeId<DoubleData>());
+    B.setNodeFlag(NodeFlag::Sink);
+
+    EXPECT_TRUE(C.nodeFlags() & NodeFlag::Sink);
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), D, PortIndex(0));
+
+    GraphExecutionModel model(graph);
+
+    EXPECT_TRUE(model.evaluateSinks().wait(maxTimeout));
+
+    // the calculator leaf is not pruned, the display is
+    EXPECT_TRUE(test::compareNodeEvalState(graph, model, {
+        {A_uuid, NodeEvalState::Valid},
+        {B_uuid, NodeEvalState::Valid},
+        {C_uuid, NodeEvalState::Valid},
+        {D_uuid, NodeEvalState::Outdated}
+    }));
+}
+
+/// Lazy inputs are only evaluated if they are demanded by the node. Thus only
+/// the branch selected by the switch node is evaluated.
+TEST(GraphExecutionModel, evaluate_lazy_inputs_on_demand)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("intelli::BoolInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("TestNumberInputNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("TestNumberInputNode"), C_uuid)
+                  .setCaption("C");
+    Node& D = builder.addNode(QStringLiteral("intelli::SwitchNode"), D_uuid)
+                  .setCaption("D");
+    Node& E = builder.addNode(QStringLiteral("intelli::NumberDisplayNode"), E_uuid)
+                  .setCaption("E");
+
+    builder.connect(A, PortIndex(0), D, PortIndex(0));
+    builder.connect(B, PortIndex(0), D, PortIndex(1));
+    builder.connect(C, PortIndex(0), D, PortIndex(2));
+    builder.connect(D, PortIndex(0), E, PortIndex(0));
+
+    setNodeProperty(A, QStringLiteral("value"), true);
+    setNodeProperty(B, QStringLiteral("value"), 1);
+    setNodeProperty(C, QStringLiteral("value"), 2);
+
+    GraphExecutionModel model(graph);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    /// false branch is not evaluated
+    EXPECT_TRUE(test::compareNodeEvalState(graph, model, {
+        {A_uuid, NodeEvalState::Valid},
+        {B_uuid, NodeEvalState::Valid},
+        {C_uuid, NodeEvalState::Outdated},
+        {D_uuid, NodeEvalState::Valid},
+        {E_uuid, NodeEvalState::Valid}
+    }));
+
+    EXPECT_TRUE(test::comparePortData<double>(graph, model, {
+        {D_uuid, PortType::Out, PortIndex(0), PortDataState::Valid, 1.0}
+    }));
+
+    gtDebug() << "Switching branch...";
+
+    setNodeProperty(A, QStringLiteral("value"), false);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A_uuid, B_uuid, C_uuid, D_uuid, E_uuid},
+        NodeEvalState::Valid));
+
+    EXPECT_TRUE(test::comparePortData<double>(graph, model, {
+        {D_uuid, PortType::Out, PortIndex(0), PortDataState::Valid, 2.0}
+    }));
+}
+
+/// The map node evaluates its body once per element of the input list
+TEST(GraphExecutionModel, evaluate_map_node)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    MapNode& map = builder.addNode<MapNode>(A_uuid);
+    map.setMaxConcurrency(2);
+
+    Graph* body = map.body();
+    ASSERT_TRUE(body);
+
+    body->initInputOutputProviders();
+    ASSERT_TRUE(body->inputProvider());
+    ASSERT_TRUE(body->outputProvider());
+    ASSERT_TRUE(body->inputProvider()->addPort(typeId<DoubleData>()).isValid());
+    ASSERT_TRUE(body->outputProvider()->addPort(typeId<DoubleData>()).isValid());
+
+    {
+        /// square each element
+        GraphBuilder bodyBuilder(*body);
+        Node& square = bodyBuilder.addNode(QStringLiteral("intelli::NumberMathNode"));
+        setNodeProperty(square, QStringLiteral("operation"), QStringLiteral("Multiply"));
+
+        bodyBuilder.connect(*body->inputProvider(), PortIndex(0), square, PortIndex(0));
+        bodyBuilder.connect(*body->inputProvider(), PortIndex(0), square, PortIndex(1));
+        bodyBuilder.connect(square, PortIndex(0), *body->outputProvider(), PortIndex(0));
+    }
+
+    GraphExecutionModel model(graph);
+
+    std::vector<NodeDataPtr> values;
+    for (double value : {1.0, 2.0, 3.0, 4.0, 5.0})
+    {
+        values.push_back(std::make_shared<DoubleData>(value));
+    }
+
+    PortId inPort = map.portId(PortType::In, PortIndex(0));
+    PortId outPort = map.portId(PortType::Out, PortIndex(0));
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, inPort,
+                                  std::make_shared<ListData>(std::move(values))));
+
+    EXPECT_TRUE(model.evaluateNode(A_uuid).wait(maxTimeout));
+
+    auto result = model.nodeData(A_uuid, outPort).as<ListData>();
+    ASSERT_TRUE(result);
+    ASSERT_EQ(result->size(), 5u);
+
+    for (size_t idx = 0; idx < result->size(); ++idx)
+    {
+        auto element = std::dynamic_pointer_cast<DoubleData const>(result->at(idx));
+        ASSERT_TRUE(element);
+        EXPECT_EQ(element->value(), (idx + 1.0) * (idx + 1.0));
+    }
+}
+
+/// Changing the inputs of an auto evaluating node while it is evaluating
+/// should cancel the running evaluation and restart it
+TEST(GraphExecutionModel, cancel_superseded_evaluation)
+{
+    std::chrono::seconds maxTimeout(3);
+
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& S = builder.addNode(QStringLiteral("TestNumberInputNode"), "S_UUID")
+                  .setCaption("S");
+    TestSleepyNode& A = builder.addNode<TestSleepyNode>(A_uuid);
+    A.setCaption("A");
+
+    builder.connect(S, PortIndex(0), A, PortIndex(0));
+
+    setNodeProperty(A, "timer", 1);
+
+    GraphExecutionModel model(graph);
+    EXPECT_TRUE(model.cancelsSupersededEvaluations());
+
+    // a canceled evaluation does not finish
+    int finishedEvaluations = 0;
+    QObject::connect(&A, &SleepyNode::timePassed, &model, [&](int progress){
+        if (progress == 100) finishedEvaluations++;
+    });
+
+    EXPECT_TRUE(model.autoEvaluateGraph());
+
+    // change input while A is evaluating
+    QTimer::singleShot(std::chrono::milliseconds(200), &model, [&](){
+        EXPECT_EQ(model.nodeEvalState(A.uuid()), NodeEvalState::Evaluating);
+        setNodeProperty(S, QStringLiteral("value"), 42);
+    });
+
+    gtTrace() << "Waiting for auto evaluation...";
+    GtEventLoop loop{maxTimeout};
+    loop.exec();
+
+    gtTrace() << "Validating...";
+    EXPECT_TRUE(model.isGraphEvaluated());
+    EXPECT_EQ(finishedEvaluations, 1);
+    EXPECT_EQ(model.nodeEvalState(A.uuid()), NodeEvalState::Valid);
+
+    PortId out = A.portId(PortType::Out, PortIndex(0));
+    auto data = model.nodeData(A.uuid(), out).as<DoubleData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 42);
+}
+
+/// Successive triggers of an auto evaluating node within the debounce window
+/// should be coalesced into a single evaluation using the latest value
+TEST(GraphExecutionModel, debounce_auto_evaluation)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("intelli::NumberMathNode"), B_uuid)
+                  .setCaption("B");
+
+    setNodeProperty(B, QStringLiteral("operation"), QStringLiteral("Plus"));
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), B, PortIndex(1));
+
+    GraphExecutionModel model(graph);
+    model.setDebounceInterval(std::chrono::milliseconds(100));
+
+    EXPECT_TRUE(model.autoEvaluateGraph());
+
+    {
+        GtEventLoop loop{maxTimeout};
+        loop.exec();
+    }
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    int evaluations = 0;
+    QObject::connect(&B, &Node::evaluated, &model, [&evaluations](){
+        evaluations++;
+    });
+
+    gtTrace() << "Changing value...";
+
+    for (int value : {1, 2, 3, 4, 5})
+    {
+        setNodeProperty(A, QStringLiteral("value"), value);
+    }
+
+    // nodes are invalidated immediately but not yet evaluated
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {A.uuid(), B.uuid()}, NodeEvalState::Outdated));
+
+    {
+        GtEventLoop loop{maxTimeout};
+        loop.exec();
+    }
+
+    gtTrace() << "Validating...";
+    EXPECT_TRUE(model.isGraphEvaluated());
+    EXPECT_EQ(evaluations, 1);
+
+    PortId out = B.portId(PortType::Out, PortIndex(0));
+    auto data = model.nodeData(B.uuid(), out).as<DoubleData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 10);
+}
+
+/// Intermediate data is released once all consumers have been evaluated and
+/// is recomputed once it is required again
+TEST(GraphExecutionModel, release_intermediate_data)
+{
+    Graph graph;
+
+    ASSERT_TRUE(test::buildLinearGraph(graph));
+
+    Node* C = graph.findNode(C_id);
+    Node* D = graph.findNode(D_id);
+    ASSERT_TRUE(C);
+    ASSERT_TRUE(D);
+
+    PortId inD = D->portId(PortType::In, PortIndex(0));
+
+    // reference
+    size_t peak = 0;
+    {
+        GraphExecutionModel model(graph);
+        EXPECT_FALSE(model.releasesIntermediateData());
+
+        EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+        EXPECT_EQ(model.releasedNodeDataCount(), 0);
+        peak = model.peakNodeDataCount();
+    }
+
+    GraphExecutionModel model(graph);
+    model.setReleaseIntermediateData(true);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    EXPECT_EQ(model.releasedNodeDataCount(), 3);
+    EXPECT_EQ(model.nodeDataCount(), 0);
+    EXPECT_LT(model.peakNodeDataCount(), peak);
+
+    EXPECT_FALSE(model.nodeData(D_uuid, inD).ptr);
+
+    gtTrace() << "Changing operation of C...";
+
+    // pinned data is not released
+    model.pinNodeData(C_uuid);
+    model.resetNodeDataStatistics();
+
+    // A and B are required again to reevaluate C
+    setNodeProperty(*C, QStringLiteral("operation"), QStringLiteral("Minus"));
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    EXPECT_EQ(model.releasedNodeDataCount(), 2);
+    EXPECT_EQ(model.nodeDataCount(), 1);
+
+    auto data = model.nodeData(D_uuid, inD).as<DoubleData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 0);
+}
+
+/// The size of the released data and the peak memory usage are reported
+TEST(GraphExecutionModel, report_memory_savings_of_released_data)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("intelli::StringInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), C_uuid)
+                  .setCaption("C");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), B, PortIndex(1));
+    builder.connect(B, PortIndex(0), C, PortIndex(0));
+
+    QString value(1000, QChar('a'));
+    setNodeProperty(A, QStringLiteral("value"), value);
+    setNodeProperty(B, QStringLiteral("pattern"), QStringLiteral("%1%2"));
+    setNodeProperty(C, QStringLiteral("pattern"), QStringLiteral("%1"));
+
+    // reference
+    size_t peak = 0;
+    {
+        GraphExecutionModel model(graph);
+
+        EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+        EXPECT_EQ(model.releasedNodeDataSize(), 0);
+        EXPECT_EQ(model.peakMemoryUsage(), model.memoryUsage());
+        peak = model.peakMemoryUsage();
+    }
+
+    GraphExecutionModel model(graph);
+    model.setReleaseIntermediateData(true);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    // data of A and B is released
+    EXPECT_EQ(model.releasedNodeDataCount(), 2);
+    EXPECT_GT(model.releasedNodeDataSize(), 0);
+    EXPECT_EQ(model.releasedNodeDataSize(), peak - model.memoryUsage());
+    EXPECT_LT(model.peakMemoryUsage(), peak);
+
+    model.resetNodeDataStatistics();
+    EXPECT_EQ(model.releasedNodeDataSize(), 0);
+    EXPECT_EQ(model.peakMemoryUsage(), model.memoryUsage());
+}
+
+/// Least recently used data is spilled to disk once the memory budget is
+/// exceeded and restored transparently once it is accessed again
+TEST(GraphExecutionModel, spill_data_exceeding_memory_budget)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("intelli::StringInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), C_uuid)
+                  .setCaption("C");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), B, PortIndex(1));
+    builder.connect(B, PortIndex(0), C, PortIndex(0));
+
+    QString value(1000, QChar('a'));
+    setNodeProperty(A, QStringLiteral("value"), value);
+    setNodeProperty(B, QStringLiteral("pattern"), QStringLiteral("%1%2"));
+    setNodeProperty(C, QStringLiteral("pattern"), QStringLiteral("%1"));
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    GraphExecutionModel model(graph);
+    model.setSpillDirectory(dir.path());
+    model.setSpillCompression(true);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    // release data held by the executors
+    QThreadPool::globalInstance()->waitForDone();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    size_t const budget = 5000;
+    EXPECT_GT(model.memoryUsage(), budget);
+
+    // A and B are spilled, C is the most recent data
+    model.setMemoryBudget(budget);
+
+    EXPECT_EQ(model.spilledNodeDataCount(), 2);
+    EXPECT_LE(model.memoryUsage(), budget);
+    EXPECT_FALSE(QDir(dir.path()).isEmpty());
+
+    // reading spilled data does not restore it
+    PortId outB = B.portId(PortType::Out, PortIndex(0));
+    auto data = model.nodeData(B_uuid, outB).as<StringData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), value + value);
+    EXPECT_EQ(model.spilledNodeDataCount(), 2);
+
+    // restoring B spills the least recently used data instead (C)
+    EXPECT_TRUE(model.restoreNodeData(B_uuid, outB));
+    EXPECT_EQ(model.spilledNodeDataCount(), 2);
+    EXPECT_LE(model.memoryUsage(), budget);
+
+    gtTrace() << "Changing pattern of B...";
+
+    // spilled inputs are restored for the evaluation
+    setNodeProperty(B, QStringLiteral("pattern"), QStringLiteral("%1-%2"));
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    PortId outC = C.portId(PortType::Out, PortIndex(0));
+    data = model.nodeData(C_uuid, outC).as<StringData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), value + '-' + value);
+}
+
+/// If spilled data cannot be read anymore, the source node is reevaluated
+/// instead of forwarding empty data
+TEST(GraphExecutionModel, reevaluate_node_if_spilled_data_is_lost)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("intelli::StringInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("intelli::StringBuilderNode"), C_uuid)
+                  .setCaption("C");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), B, PortIndex(1));
+    builder.connect(B, PortIndex(0), C, PortIndex(0));
+
+    QString value(1000, QChar('a'));
+    setNodeProperty(A, QStringLiteral("value"), value);
+    setNodeProperty(B, QStringLiteral("pattern"), QStringLiteral("%1%2"));
+    setNodeProperty(C, QStringLiteral("pattern"), QStringLiteral("%1"));
+
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    GraphExecutionModel model(graph);
+    model.setSpillDirectory(dir.path());
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    // release data held by the executors
+    QThreadPool::globalInstance()->waitForDone();
+    QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+
+    // A and B are spilled
+    model.setMemoryBudget(5000);
+    ASSERT_EQ(model.spilledNodeDataCount(), 2);
+
+    // spilled data is lost
+    QDir spillDir(dir.path());
+    for (QString const& file : spillDir.entryList(QDir::Files))
+    {
+        ASSERT_TRUE(spillDir.remove(file));
+    }
+
+    size_t evaluatedA = 0;
+    QObject::connect(&model, &GraphExecutionModel::nodeEvaluated,
+                     &graph, [&](NodeUuid const& uuid){
+        if (uuid == A_uuid) evaluatedA++;
+    });
+
+    gtTrace() << "Changing pattern of B...";
+
+    setNodeProperty(B, QStringLiteral("pattern"), QStringLiteral("%1-%2"));
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    // A is reevaluated although its inputs did not change
+    EXPECT_EQ(evaluatedA, 1);
+
+    PortId outC = C.portId(PortType::Out, PortIndex(0));
+    auto data = model.nodeData(C_uuid, outC).as<StringData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), value + '-' + value);
+}
+
+/// Async nodes do not occupy a thread while waiting, thus more nodes than
+/// threads are evaluated concurrently
+TEST(GraphExecutionModel, evaluate_async_nodes)
+{
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+
+    setNodeProperty(A, QStringLiteral("value"), 21);
+
+    // each node waits 50 ms, evaluating them sequentially would time out
+    constexpr size_t count = 32;
+
+    std::vector<TestAsyncNode*> nodes;
+    for (size_t i = 0; i < count; ++i)
+    {
+        auto& node = builder.addNode<TestAsyncNode>();
+        builder.connect(A, PortIndex(0), node, PortIndex(0));
+        nodes.push_back(&node);
+    }
+
+    GraphExecutionModel model(graph);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    for (TestAsyncNode* node : nodes)
+    {
+        PortId out = node->portId(PortType::Out, PortIndex(0));
+        auto data = model.nodeData(node->uuid(), out).as<DoubleData>();
+        ASSERT_TRUE(data);
+        EXPECT_EQ(data->value(), 42.0);
+    }
+
+    gtTrace() << "Failing evaluation...";
+
+    TestAsyncNode* node = nodes.front();
+    node->failEvaluation = true;
+
+    EXPECT_TRUE(model.invalidateNode(node->uuid()));
+    EXPECT_FALSE(model.evaluateNode(node->uuid()).wait(maxTimeout));
+    EXPECT_EQ(model.nodeEvalState(node->uuid()), NodeEvalState::Invalid);
+}
+
 /// If a nodes fails during evaluation all successor nodes are marked as failed
 /// as well.
 TEST(GraphExecutionModel, propagate_failed_evaluation)
@@ -1739,6 +2475,66 @@ TEST(GraphExecutionModel, evaluation_of_exclusive_nodes_across_multiple_graphs)
     EXPECT_TRUE(model2.isGraphEvaluated());
 }
 
+/// Nodes that contend for the same resource are evaluated separatly, whereas
+/// nodes that require other resources may still be evaluated concurrently
+TEST(GraphExecutionModel, evaluation_of_nodes_with_resources)
+{
+    std::chrono::seconds maxTimeout(4);
+
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& S = builder.addNode(QStringLiteral("TestNumberInputNode"), "S_UUID")
+                  .setCaption("S");
+    TestSleepyNode& A = builder.addNode<TestSleepyNode>(A_uuid);
+    A.setCaption("A");
+    TestSleepyNode& B = builder.addNode<TestSleepyNode>(B_uuid);
+    B.setCaption("B");
+    TestSleepyNode& C = builder.addNode<TestSleepyNode>(C_uuid);
+    C.setCaption("C");
+
+    builder.connect(S, PortIndex(0), A, PortIndex(0));
+    builder.connect(S, PortIndex(0), B, PortIndex(0));
+    builder.connect(S, PortIndex(0), C, PortIndex(0));
+
+    setNodeProperty(A, "timer", 1);
+    setNodeProperty(B, "timer", 1);
+    setNodeProperty(C, "timer", 1);
+
+    A.setResources({{"test:resource", ResourceAccess::Exclusive}});
+    B.setResources({{"test:resource", ResourceAccess::Shared}});
+    C.setResources({{"test:other", ResourceAccess::Exclusive}});
+
+    GraphExecutionModel model(graph);
+
+    int maxNodesEvaluating = 0;
+
+    auto checkState = [&](){
+        bool isEvaluatingA = model.nodeEvalState(A.uuid()) == NodeEvalState::Evaluating;
+        bool isEvaluatingB = model.nodeEvalState(B.uuid()) == NodeEvalState::Evaluating;
+        bool isEvaluatingC = model.nodeEvalState(C.uuid()) == NodeEvalState::Evaluating;
+
+        EXPECT_FALSE(isEvaluatingA && isEvaluatingB);
+
+        maxNodesEvaluating = std::max(maxNodesEvaluating,
+                                      isEvaluatingA + isEvaluatingB + isEvaluatingC);
+    };
+
+    QObject::connect(&A, &Node::nodeEvalStateChanged, &model, checkState);
+    QObject::connect(&B, &Node::nodeEvalStateChanged, &model, checkState);
+    QObject::connect(&C, &Node::nodeEvalStateChanged, &model, checkState);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    EXPECT_EQ(maxNodesEvaluating, 2);
+
+    EXPECT_TRUE(test::compareNodeEvalState(
+        graph, model, {
+            S.uuid(), A.uuid(), B.uuid(), C.uuid()
+        }, NodeEvalState::Valid));
+}
+
 /// Attempting to evaluate a cyclic graph does not cause infinite loop but
 /// simply fails
 TEST(GraphExecutionModel, evaluation_of_cyclic_graph)
@@ -2013,3 +2809,91 @@ TEST(GraphExecutionModel, future_then_with_timeout)
     EXPECT_TRUE(functionCalled);
     EXPECT_TRUE(model.isGraphEvaluated());
 }
+
+/// Each observer of a future is notified exactly once, regardless of how many
+/// other futures are waiting for the same or other nodes
+TEST(GraphExecutionModel, future_then_many_observers)
+{
+    Graph graph;
+
+    GraphExecutionModel model(graph);
+
+    ASSERT_TRUE(test::buildLinearGraph(graph));
+
+    constexpr int observersPerNode = 50;
+
+    std::map<NodeUuid, int> callbacks;
+
+    gtTrace() << "Evaluate...";
+
+    for (NodeUuid const& nodeUuid : {A_uuid, B_uuid, C_uuid, D_uuid})
+    {
+        for (int i = 0; i < observersPerNode; ++i)
+        {
+            model.evaluateNode(nodeUuid).then([&callbacks, nodeUuid](bool success){
+                EXPECT_TRUE(success);
+                callbacks[nodeUuid]++;
+            });
+        }
+    }
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    gtTrace() << "Validate...";
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    for (NodeUuid const& nodeUuid : {A_uuid, B_uuid, C_uuid, D_uuid})
+    {
+        EXPECT_EQ(callbacks[nodeUuid], observersPerNode);
+    }
+}
+
+/// Futures of multiple exec models can be awaited from a different thread
+/// without an event loop
+TEST(GraphExecutionModel, future_wait_all_and_any_from_other_thread)
+{
+    std::chrono::seconds timeout(4);
+
+    Graph graph1;
+    GraphExecutionModel model1(graph1);
+    ASSERT_TRUE(test::buildLinearGraph(graph1));
+
+    Graph graph2;
+    GraphExecutionModel model2(graph2);
+
+    GraphBuilder builder(graph2);
+    Node& S = builder.addNode(QStringLiteral("TestNumberInputNode"), "S_UUID")
+                  .setCaption("S");
+    TestSleepyNode& A = builder.addNode<TestSleepyNode>(A_uuid);
+    A.setCaption("A");
+    builder.connect(S, PortIndex(0), A, PortIndex(0));
+
+    setNodeProperty(A, "timer", 1);
+
+    gtTrace() << "Evaluate...";
+
+    auto future1 = model1.evaluateGraph();
+    auto future2 = model2.evaluateGraph();
+
+    using Result = std::pair<int, bool>;
+    QFuture<Result> waiting = QtConcurrent::run([=](){
+        int first = ExecFuture::waitAny({future1, future2}, timeout);
+        bool all  = ExecFuture::waitAll({future1, future2}, timeout);
+        return Result{first, all};
+    });
+
+    // exec models must continue to process events
+    QFutureWatcher<Result> watcher;
+    GtEventLoop loop{timeout};
+    loop.connectSuccess(&watcher, &QFutureWatcher<Result>::finished);
+    watcher.setFuture(waiting);
+    loop.exec();
+
+    gtTrace() << "Validate...";
+    ASSERT_TRUE(waiting.isFinished());
+    EXPECT_EQ(waiting.result().first, 0);
+    EXPECT_TRUE(waiting.result().second);
+
+    EXPECT_TRUE(model1.isGraphEvaluated());
+    EXPECT_TRUE(model2.isGraphEvaluated());
+}
@@ -12,9 +12,19 @@
 #include "data/test_nodedata.h"
 
 #include <intelli/nodedatafactory.h>
+#include <intelli/nodedatapool.h>
+#include <intelli/data/bytearray.h>
+#include <intelli/data/double.h>
 #include <intelli/data/file.h>
+#include <intelli/data/list.h>
+#include <intelli/data/string.h>
+#include <intelli/data/stringlist.h>
 
+#include <QDataStream>
 #include <QFileInfo>
+#include <QThread>
+
+#include <thread>
 
 using namespace intelli;
 
@@ -120,3 +130,117 @@ TEST(NodeData, convert_compatible_type)
 
     EXPECT_EQ(intelli::convert<TestNodeData>(doubleDataPtr)->myDouble(), doubleData->value());
 }
+
+/// plain value data is recycled once it is no longer referenced
+TEST(NodeData, node_data_pool_recycles_objects)
+{
+    auto data = makeNodeData<DoubleData>(42.0);
+    ASSERT_TRUE(data);
+    EXPECT_DOUBLE_EQ(data->value(), 42.0);
+
+    DoubleData const* oldPtr = data.get();
+    size_t size = NodeDataPool<DoubleData>::size();
+
+    data.reset();
+    EXPECT_EQ(NodeDataPool<DoubleData>::size(), size + 1);
+
+    auto other = makeNodeData<DoubleData>(12.0);
+    ASSERT_TRUE(other);
+    EXPECT_EQ(other.get(), oldPtr);
+    EXPECT_DOUBLE_EQ(other->value(), 12.0);
+    EXPECT_EQ(NodeDataPool<DoubleData>::size(), size);
+
+    // recycled data is still valid node data
+    NodeDataPtr ptr = other;
+    auto res = ptr->invoke<double>(QStringLiteral("value"));
+    ASSERT_TRUE(res.has_value());
+    EXPECT_DOUBLE_EQ(res.value(), 12.0);
+}
+
+/// recycled objects are reset and objects of other threads are not recycled
+TEST(NodeData, node_data_pool_resets_objects)
+{
+    auto data = makeNodeData<DoubleData>(42.0);
+    ASSERT_TRUE(data);
+    const_cast<DoubleData&>(*data).setObjectName(QStringLiteral("test"));
+    const_cast<DoubleData&>(*data).setProperty("dynamic", 42);
+
+    data.reset();
+
+    auto other = makeNodeData<DoubleData>(12.0);
+    ASSERT_TRUE(other);
+    EXPECT_TRUE(other->objectName().isEmpty());
+    EXPECT_FALSE(other->property("dynamic").isValid());
+    EXPECT_EQ(other->thread(), QThread::currentThread());
+
+    size_t size = NodeDataPool<DoubleData>::size();
+
+    // released in an other thread -> deleted
+    std::thread thread{[ptr = std::move(other)]() mutable {
+        ptr.reset();
+    }};
+    thread.join();
+
+    EXPECT_EQ(NodeDataPool<DoubleData>::size(), size);
+}
+
+/// data that cannot be recycled is created as usual
+TEST(NodeData, node_data_pool_fallback)
+{
+    auto data = makeNodeData<TestNodeData>(42.0);
+    ASSERT_TRUE(data);
+    EXPECT_DOUBLE_EQ(data->myDouble(), 42.0);
+}
+
+/// large data is only compared by identity, thus equal contents in separate
+/// buffers are considered unequal
+TEST(NodeData, compare_large_data_by_identity)
+{
+    QByteArray bytes(1024, 'a');
+    EXPECT_TRUE(isEqual(std::make_shared<ByteArrayData>(bytes),
+                        std::make_shared<ByteArrayData>(bytes)));
+    EXPECT_FALSE(isEqual(std::make_shared<ByteArrayData>(bytes),
+                         std::make_shared<ByteArrayData>(QByteArray(1024, 'a'))));
+
+    QStringList list{QStringLiteral("a"), QStringLiteral("b")};
+    EXPECT_TRUE(isEqual(std::make_shared<StringListData>(list),
+                        std::make_shared<StringListData>(list)));
+    EXPECT_FALSE(isEqual(std::make_shared<StringListData>(list),
+                         std::make_shared<StringListData>(
+                             QStringList{QStringLiteral("a"), QStringLiteral("b")})));
+}
+
+/// node data can be restored from its serialized form
+TEST(NodeData, serialize_and_deserialize)
+{
+    auto& factory = NodeDataFactory::instance();
+
+    auto list = std::make_shared<ListData>(std::vector<NodeDataPtr>{
+        std::make_shared<DoubleData>(42.0),
+        std::make_shared<StringData>(QStringLiteral("test")),
+        nullptr
+    });
+
+    QByteArray bytes;
+    QDataStream out(&bytes, QIODevice::WriteOnly);
+    EXPECT_TRUE(factory.serialize(list, out));
+    EXPECT_TRUE(factory.serialize(nullptr, out));
+
+    QDataStream in(bytes);
+    auto restored = factory.deserialize(in);
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_TRUE(isEqual(*restored, list));
+
+    auto null = factory.deserialize(in);
+    ASSERT_TRUE(null.has_value());
+    EXPECT_EQ(*null, nullptr);
+}
+
+/// serialization fails for data that does not implement it
+TEST(NodeData, serialize_unsupported_data)
+{
+    QByteArray bytes;
+    QDataStream out(&bytes, QIODevice::WriteOnly);
+    EXPECT_FALSE(NodeDataFactory::instance().serialize(
+        std::make_shared<TestNodeData>(42.0), out));
+}
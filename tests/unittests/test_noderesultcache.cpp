@@ -0,0 +1,164 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+#include "node/test_node.h"
+
+#include "intelli/noderesultcache.h"
+#include "intelli/graphexecmodel.h"
+#include "intelli/data/double.h"
+
+#include <QTemporaryDir>
+
+using namespace intelli;
+
+constexpr auto maxTimeout = std::chrono::seconds(1);
+
+/// Cacheable node, whose implementation was changed
+class TestCacheableNodeV2 : public TestCacheableNode
+{
+public:
+
+    TestCacheableNodeV2() { setCacheVersion(2); }
+};
+
+/// Builds a graph consisting of a number input and a cacheable node
+bool buildCacheableGraph(Graph& graph, double value)
+{
+    GraphBuilder builder(graph);
+
+    try
+    {
+        Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                      .setCaption("A");
+        Node& B = builder.addNode(QStringLiteral("TestCacheableNode"), B_uuid)
+                      .setCaption("B");
+
+        builder.connect(A, PortIndex(0), B, PortIndex(0));
+
+        setNodeProperty(A, QStringLiteral("value"), value);
+    }
+    catch (std::logic_error const& e)
+    {
+        gtError() << e.what();
+        return false;
+    }
+
+    return true;
+}
+
+/// Entries can be stored and loaded, the key depends on the inputs
+TEST(NodeResultCache, store_and_load)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    NodeResultCache cache(dir.path());
+    EXPECT_EQ(cache.size(), 0);
+
+    TestCacheableNode node;
+    PortId in  = node.portId(PortType::In, PortIndex(0));
+    PortId out = node.portId(PortType::Out, PortIndex(0));
+
+    QByteArray key = NodeResultCache::key(node, {{in, std::make_shared<DoubleData>(1)}});
+    QByteArray other = NodeResultCache::key(node, {{in, std::make_shared<DoubleData>(2)}});
+    ASSERT_FALSE(key.isEmpty());
+    EXPECT_NE(key, other);
+
+    // the position of the node does not affect its results
+    node.setPos({42, 42});
+    EXPECT_EQ(key, NodeResultCache::key(node, {{in, std::make_shared<DoubleData>(1)}}));
+
+    // results of a previous implementation are not reused
+    TestCacheableNodeV2 nodeV2;
+    EXPECT_EQ(nodeV2.cacheVersion(), 2);
+    EXPECT_NE(key, NodeResultCache::key(nodeV2, {{in, std::make_shared<DoubleData>(1)}}));
+
+    EXPECT_FALSE(cache.contains(key));
+    EXPECT_FALSE(cache.load(key));
+
+    EXPECT_TRUE(cache.store(key, {{out, std::make_shared<DoubleData>(2)}}));
+    EXPECT_TRUE(cache.contains(key));
+    EXPECT_FALSE(cache.contains(other));
+    EXPECT_GT(cache.size(), 0);
+
+    auto data = cache.load(key);
+    ASSERT_TRUE(data);
+    ASSERT_EQ(data->size(), 1);
+    EXPECT_EQ(data->at(0).first, out);
+    auto value = convert<DoubleData>(data->at(0).second);
+    ASSERT_TRUE(value);
+    EXPECT_EQ(value->value(), 2.0);
+
+    // entries are evicted once the cache exceeds its max. size
+    cache.setMaxSize(0);
+    EXPECT_FALSE(cache.contains(key));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+/// The results of a cacheable node are loaded from the cache in a new session
+TEST(NodeResultCache, load_results_instead_of_evaluating)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    auto cache = std::make_shared<NodeResultCache>(dir.path());
+
+    {
+        Graph graph;
+        ASSERT_TRUE(buildCacheableGraph(graph, 21));
+
+        GraphExecutionModel model(graph);
+        model.setResultCache(cache);
+
+        EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+        EXPECT_TRUE(model.isGraphEvaluated());
+
+        auto* B = qobject_cast<TestCacheableNode*>(graph.findNodeByUuid(B_uuid));
+        ASSERT_TRUE(B);
+        EXPECT_EQ(B->evalCount, 1);
+    }
+
+    EXPECT_GT(cache->size(), 0);
+
+    gtTrace() << "New session...";
+
+    Graph graph;
+    ASSERT_TRUE(buildCacheableGraph(graph, 21));
+
+    GraphExecutionModel model(graph);
+    model.setResultCache(cache);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+
+    auto* B = qobject_cast<TestCacheableNode*>(graph.findNodeByUuid(B_uuid));
+    ASSERT_TRUE(B);
+    EXPECT_EQ(B->evalCount, 0);
+
+    PortId out = B->portId(PortType::Out, PortIndex(0));
+    auto data = model.nodeData(B_uuid, out).as<DoubleData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 42.0);
+
+    gtTrace() << "Changing input...";
+
+    // no entry exists for the new input
+    Node* A = graph.findNodeByUuid(A_uuid);
+    ASSERT_TRUE(A);
+    setNodeProperty(*A, QStringLiteral("value"), 2);
+
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+    EXPECT_TRUE(model.isGraphEvaluated());
+    EXPECT_EQ(B->evalCount, 1);
+
+    data = model.nodeData(B_uuid, out).as<DoubleData>();
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 4.0);
+}
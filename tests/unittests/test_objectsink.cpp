@@ -0,0 +1,203 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+
+#include "intelli/connection.h"
+#include "intelli/data/object.h"
+#include "intelli/node/objectsink.h"
+
+#include <gt_objectmemento.h>
+
+using namespace intelli;
+
+namespace
+{
+
+/// Adds an object sink to the graph, that exports to `target`
+ObjectSink* addObjectSink(Graph& graph, GtObject const* target)
+{
+    GraphBuilder builder(graph);
+
+    try
+    {
+        Node& node = builder.addNode(QStringLiteral("intelli::ObjectSink"), A_uuid)
+                         .setCaption("A");
+        if (target) setNodeProperty(node, QStringLiteral("target"), target->uuid());
+        return qobject_cast<ObjectSink*>(&node);
+    }
+    catch (std::logic_error const& e)
+    {
+        gtError() << e.what();
+        return nullptr;
+    }
+}
+
+/// Creates a connection object, which is used as a generic GtObject
+std::unique_ptr<Connection> makeObject(QString const& name, unsigned value)
+{
+    auto obj = std::make_unique<Connection>();
+    obj->setObjectName(name);
+    obj->setOutNodeId(NodeId(value));
+    return obj;
+}
+
+} // namespace
+
+/// The sink has a single object input and is evaluated as a sink
+TEST(ObjectSink, ports_and_flags)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    ObjectSink* sink = addObjectSink(graph, nullptr);
+    ASSERT_TRUE(sink);
+
+    ASSERT_EQ(sink->ports(PortType::In).size(), 1);
+    EXPECT_EQ(sink->ports(PortType::Out).size(), 0);
+    EXPECT_EQ(sink->ports(PortType::In).at(0).typeId, typeId<ObjectData>());
+
+    EXPECT_TRUE(sink->nodeFlags() & NodeFlag::Sink);
+    EXPECT_EQ(sink->nodeEvalMode(), NodeEvalMode::Blocking);
+
+    // nothing to export without input
+    EXPECT_FALSE(sink->canExport());
+}
+
+/// The received object is stored as input data and enables the export. Empty
+/// input disables the export again.
+TEST(ObjectSink, stores_received_object)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    ObjectSink* sink = addObjectSink(graph, nullptr);
+    ASSERT_TRUE(sink);
+
+    QVector<bool> changes;
+    QObject::connect(sink, &ObjectSink::exportEnabledChanged,
+                     sink, [&changes](bool enabled){ changes.push_back(enabled); });
+
+    auto source = makeObject(QStringLiteral("Source"), 42);
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<ObjectData>(source.get())));
+    EXPECT_TRUE(sink->canExport());
+    EXPECT_EQ(changes, QVector<bool>({true}));
+
+    // the sink holds a copy of the object
+    auto data = model.nodeData(A_uuid, PortType::In, PortIndex(0))
+                    .as<ObjectData>();
+    ASSERT_TRUE(data);
+    ASSERT_TRUE(data->object());
+    EXPECT_NE(data->object(), source.get());
+    EXPECT_EQ(data->object()->objectName(), source->objectName());
+    EXPECT_EQ(data->object()->toMemento().toByteArray(),
+              source->toMemento().toByteArray());
+
+    // setting the same state again does not emit a change
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<ObjectData>(source.get())));
+    EXPECT_EQ(changes, QVector<bool>({true}));
+
+    // empty input disables the export
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0), NodeDataPtr{}));
+    EXPECT_FALSE(sink->canExport());
+    EXPECT_EQ(changes, QVector<bool>({true, false}));
+}
+
+/// Exporting without input, without target, without scope or to a target that
+/// does not exist does not modify any object
+TEST(ObjectSink, export_with_invalid_input_is_ignored)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    GtObject scope;
+    Connection* target = makeObject(QStringLiteral("Target"), 1).release();
+    scope.appendChild(target);
+
+    QString const uuid = target->uuid();
+    QByteArray const initial = target->toMemento().toByteArray();
+
+    auto const isUnchanged = [&](){
+        auto* t = qobject_cast<Connection*>(scope.getObjectByUuid(uuid));
+        return t == target &&
+               scope.findDirectChildren<GtObject*>().size() == 1 &&
+               t->findDirectChildren<GtObject*>().isEmpty() &&
+               t->toMemento().toByteArray() == initial;
+    };
+
+    ObjectSink* sink = addObjectSink(graph, target);
+    ASSERT_TRUE(sink);
+
+    // no input
+    sink->exportObject();
+    EXPECT_TRUE(isUnchanged());
+
+    auto source = makeObject(QStringLiteral("Source"), 42);
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<ObjectData>(source.get())));
+    ASSERT_TRUE(sink->canExport());
+
+    // no scope to resolve the target
+    sink->exportObject();
+    EXPECT_TRUE(isUnchanged());
+
+    model.setScope(&scope);
+
+    // no target
+    setNodeProperty(*sink, QStringLiteral("target"), QString{});
+    sink->exportObject();
+    EXPECT_TRUE(isUnchanged());
+
+    // target does not exist
+    setNodeProperty(*sink, QStringLiteral("target"), QStringLiteral("unknown-uuid"));
+    sink->exportObject();
+    EXPECT_TRUE(isUnchanged());
+
+    // object data without object
+    setNodeProperty(*sink, QStringLiteral("target"), uuid);
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<ObjectData>(nullptr)));
+    EXPECT_FALSE(sink->canExport());
+    sink->exportObject();
+    EXPECT_TRUE(isUnchanged());
+}
+
+/// Merging an object, that only differs in its identity, keeps the target
+TEST(ObjectSink, merge_keeps_identity_of_target)
+{
+    Graph graph;
+    GraphExecutionModel model(graph);
+
+    GtObject scope;
+    Connection* target = makeObject(QStringLiteral("Target"), 42).release();
+    scope.appendChild(target);
+    model.setScope(&scope);
+
+    QString const uuid = target->uuid();
+    QByteArray const initial = target->toMemento().toByteArray();
+
+    ObjectSink* sink = addObjectSink(graph, target);
+    ASSERT_TRUE(sink);
+
+    // same content, but different name and uuid
+    auto source = makeObject(QStringLiteral("Source"), 42);
+    ASSERT_NE(source->uuid(), uuid);
+
+    ASSERT_TRUE(model.setNodeData(A_uuid, PortType::In, PortIndex(0),
+                                  std::make_shared<ObjectData>(source.get())));
+    sink->exportObject();
+
+    // the target is neither replaced nor renamed
+    EXPECT_EQ(scope.getObjectByUuid(uuid), target);
+    EXPECT_EQ(target->objectName(), QStringLiteral("Target"));
+    EXPECT_EQ(target->toMemento().toByteArray(), initial);
+}
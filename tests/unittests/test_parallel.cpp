@@ -0,0 +1,104 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include <gtest/gtest.h>
+
+#include "intelli/parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+using namespace intelli;
+
+/// Each index is processed exactly once
+TEST(Parallel, parallel_for)
+{
+    constexpr size_t count = 10000;
+
+    std::vector<std::atomic<int>> visited(count);
+
+    exec::ParallelOptions options;
+    options.grainSize = 64;
+
+    EXPECT_TRUE(exec::parallelFor(count, [&](size_t begin, size_t end){
+        ASSERT_LT(begin, end);
+        ASSERT_LE(end, count);
+        EXPECT_LE(end - begin, options.grainSize);
+        for (size_t i = begin; i < end; ++i) visited[i]++;
+    }, options));
+
+    EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](auto& v){
+        return v == 1;
+    }));
+
+    // empty range
+    EXPECT_TRUE(exec::parallelFor(0, [](size_t, size_t){
+        FAIL() << "should not be called";
+    }));
+}
+
+/// The partial results are combined in order
+TEST(Parallel, parallel_reduce)
+{
+    constexpr size_t count = 10001;
+
+    std::vector<double> values(count);
+    std::iota(values.begin(), values.end(), 0.0);
+
+    auto sum = exec::parallelReduce(count, 0.0, [&](size_t begin, size_t end){
+        return std::accumulate(values.begin() + begin, values.begin() + end, 0.0);
+    }, std::plus<double>{});
+
+    ASSERT_TRUE(sum);
+    EXPECT_EQ(*sum, count * (count - 1) / 2.0);
+
+    // non-commutative reduction
+    exec::ParallelOptions options;
+    options.grainSize = 1;
+
+    auto string = exec::parallelReduce(10, std::string{}, [](size_t begin, size_t){
+        return std::to_string(begin);
+    }, std::plus<std::string>{}, options);
+
+    ASSERT_TRUE(string);
+    EXPECT_EQ(*string, "0123456789");
+}
+
+/// Remaining chunks are skipped once canceled
+TEST(Parallel, cancel)
+{
+    std::atomic<size_t> processed{0};
+
+    exec::ParallelOptions options;
+    options.grainSize = 1;
+    options.isCanceled = [&](){ return processed >= 10; };
+
+    EXPECT_FALSE(exec::parallelFor(1000, [&](size_t, size_t){
+        processed++;
+    }, options));
+
+    EXPECT_LT(processed, 1000);
+
+    auto result = exec::parallelReduce(1000, 0, [](size_t, size_t){
+        return 1;
+    }, std::plus<int>{}, options);
+
+    EXPECT_FALSE(result);
+}
+
+/// Exceptions are rethrown in the calling thread
+TEST(Parallel, exception)
+{
+    EXPECT_THROW(exec::parallelFor(1000, [](size_t begin, size_t end){
+        if (begin <= 500 && 500 < end) throw std::runtime_error("error");
+    }), std::runtime_error);
+}
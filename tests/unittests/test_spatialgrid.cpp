@@ -0,0 +1,69 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+
+#include "intelli/private/spatialgrid.h"
+
+using namespace intelli;
+
+TEST(SpatialGrid, find_keys_within_region)
+{
+    SpatialGrid<int> grid(100);
+
+    grid.insert(1, QRectF{  10,   10, 50, 50});
+    grid.insert(2, QRectF{ 150,   10, 50, 50});
+    grid.insert(3, QRectF{-250, -250, 50, 50});
+    EXPECT_EQ(grid.size(), 3);
+
+    EXPECT_EQ(grid.find(QRectF{0, 0, 100, 100}), QSet<int>({1}));
+    EXPECT_EQ(grid.find(QRectF{0, 0, 300, 100}), QSet<int>({1, 2}));
+    EXPECT_EQ(grid.find(QRectF{-300, -300, 100, 100}), QSet<int>({3}));
+    EXPECT_TRUE(grid.find(QRectF{1000, 1000, 100, 100}).isEmpty());
+
+    // a region covering more cells than occupied visits the occupied cells
+    EXPECT_EQ(grid.find(QRectF{-10000, -10000, 20000, 20000}),
+              QSet<int>({1, 2, 3}));
+}
+
+TEST(SpatialGrid, move_and_remove_keys)
+{
+    SpatialGrid<int> grid(100);
+
+    grid.insert(1, QRectF{10, 10, 50, 50});
+    ASSERT_EQ(grid.find(QRectF{0, 0, 100, 100}), QSet<int>({1}));
+
+    // moving the key removes it from its previous cells
+    grid.insert(1, QRectF{510, 510, 50, 50});
+    EXPECT_EQ(grid.size(), 1);
+    EXPECT_TRUE(grid.find(QRectF{0, 0, 100, 100}).isEmpty());
+    EXPECT_EQ(grid.find(QRectF{500, 500, 100, 100}), QSet<int>({1}));
+    EXPECT_EQ(grid.rect(1), QRectF(510, 510, 50, 50));
+
+    grid.remove(1);
+    EXPECT_EQ(grid.size(), 0);
+    EXPECT_FALSE(grid.contains(1));
+    EXPECT_TRUE(grid.find(QRectF{500, 500, 100, 100}).isEmpty());
+}
+
+TEST(SpatialGrid, large_keys_are_always_visited)
+{
+    SpatialGrid<int> grid(100);
+
+    // spans more cells than allowed
+    grid.insert(1, QRectF{0, 0, 10000, 10000});
+    grid.insert(2, QRectF{10, 10, 50, 50});
+
+    EXPECT_EQ(grid.find(QRectF{5000, 5000, 100, 100}), QSet<int>({1}));
+    EXPECT_EQ(grid.find(QRectF{0, 0, 100, 100}), QSet<int>({1, 2}));
+    EXPECT_TRUE(grid.find(QRectF{20000, 20000, 100, 100}).isEmpty());
+
+    grid.remove(1);
+    EXPECT_TRUE(grid.find(QRectF{5000, 5000, 100, 100}).isEmpty());
+}
@@ -0,0 +1,99 @@
+/*
+ * GTlab IntelliGraph
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ *  SPDX-FileCopyrightText: 2026 German Aerospace Center
+ *
+ *  Author: Marius Bröcker <marius.broecker@dlr.de>
+ */
+
+#include "test_helper.h"
+#include "node/test_node.h"
+
+#include "intelli/graphexecmodel.h"
+#include "intelli/data/double.h"
+
+#include <QCoreApplication>
+
+using namespace intelli;
+
+/// launching a worker process takes some time
+constexpr auto maxTimeout = std::chrono::seconds(10);
+
+/// the test executable is used as the worker program
+void setupWorkerProgram()
+{
+    exec::setWorkerProgram(QCoreApplication::applicationFilePath(),
+                           {QStringLiteral("--worker")});
+}
+
+/// The isolated node is evaluated in a worker process
+TEST(WorkerPool, evaluate_node_in_worker_process)
+{
+    setupWorkerProgram();
+
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("TestIsolatedNode"), B_uuid)
+                  .setCaption("B");
+    Node& C = builder.addNode(QStringLiteral("TestIsolatedNode"), C_uuid)
+                  .setCaption("C");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+    builder.connect(A, PortIndex(0), C, PortIndex(0));
+
+    setNodeProperty(A, QStringLiteral("value"), 21);
+
+    GraphExecutionModel model(graph);
+    EXPECT_TRUE(model.evaluateGraph().wait(maxTimeout));
+
+    for (Node* node : {&B, &C})
+    {
+        PortId outPort = node->portId(PortType::Out, PortIndex(0));
+
+        auto data = convert<DoubleData>(model.nodeData(node->uuid(), outPort).ptr);
+        ASSERT_TRUE(data);
+        EXPECT_EQ(data->value(), 42.0);
+    }
+}
+
+/// A crashing node only terminates the worker process, subsequent evaluations
+/// are not affected
+TEST(WorkerPool, crashing_node_fails_evaluation)
+{
+    setupWorkerProgram();
+
+    Graph graph;
+
+    GraphBuilder builder(graph);
+
+    Node& A = builder.addNode(QStringLiteral("TestNumberInputNode"), A_uuid)
+                  .setCaption("A");
+    Node& B = builder.addNode(QStringLiteral("TestIsolatedNode"), B_uuid)
+                  .setCaption("B");
+
+    builder.connect(A, PortIndex(0), B, PortIndex(0));
+
+    setNodeProperty(A, QStringLiteral("value"), 21);
+    setNodeProperty(B, QStringLiteral("crash"), true);
+
+    GraphExecutionModel model(graph);
+    EXPECT_FALSE(model.evaluateNode(B_uuid).wait(maxTimeout));
+    EXPECT_EQ(model.nodeEvalState(B_uuid), NodeEvalState::Invalid);
+
+    gtDebug() << "Disabling crash...";
+
+    setNodeProperty(B, QStringLiteral("crash"), false);
+
+    EXPECT_TRUE(model.evaluateNode(B_uuid).wait(maxTimeout));
+
+    PortId outPort = B.portId(PortType::Out, PortIndex(0));
+
+    auto data = convert<DoubleData>(model.nodeData(B_uuid, outPort).ptr);
+    ASSERT_TRUE(data);
+    EXPECT_EQ(data->value(), 42.0);
+}